@@ -0,0 +1,945 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>     // For std::exp, std::pow
+#include <cstdint>
+#include <cstdio>    // For std::remove
+#include <cstdlib>
+#if defined(__GLIBC__)
+#include <malloc.h>   // For mallinfo2
+#endif
+#include <algorithm>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <functional>   // For std::hash
+#include <string>
+#include <string_view>
+#include <vector>
+#include "hashMap.h"
+#include "hashSet.h"
+#include "robinHoodHashMap.h"
+#include "swissHashSet.h"
+#include "concurrentHashMap.h"
+#include "blockedBloomFilter.h"
+#include "cuckooFilter.h"
+#include "cuckooHashMap.h"
+#include "stringArenaMap.h"
+#include "hashSnapshot.h"
+#include "hashTableStats.h"
+#include "staticHashMap.h"
+#include "concurrentCache.h"
+
+// Distinct pseudo-random non-negative keys: i -> i * odd constant is a bijection modulo 2^31
+static std::vector<int> makeKeys(size_t count, uint32_t salt) {
+    std::vector<int> keys(count);
+    for (size_t i = 0; i < count; i++) {
+        uint32_t mixed = static_cast<uint32_t>(i) * 2654435761u + salt;
+        keys[i] = static_cast<int>(mixed & 0x7FFFFFFF);
+    }
+    return keys;
+}
+
+// Nanoseconds per call of 'operation' over every key
+template<typename Operation>
+static double nanosecondsPerKey(const std::vector<int>& keys, Operation operation) {
+    auto start = std::chrono::steady_clock::now();
+    for (int key : keys) {
+        operation(key);
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / keys.size();
+}
+
+// Inserts 'count' keys, then looks up every key (hits) and as many absent keys (misses)
+template<typename Map>
+static void benchmarkMap(const char* name, size_t count) {
+    std::vector<int> keys = makeKeys(count, 0);
+    std::vector<int> absent = makeKeys(count, 0x80000000u);   // Same pattern shifted out of the key set
+    for (int& key : absent) key = -1 - key;                   // Negative keys are never inserted
+    const std::string value = "value";
+    volatile size_t found = 0;
+
+    Map map;
+    double insertNs = nanosecondsPerKey(keys, [&](int key) { map.insert(key, value); });
+    double hitNs = nanosecondsPerKey(keys, [&](int key) { found = found + map.contains(key); });
+    double missNs = nanosecondsPerKey(absent, [&](int key) { found = found + map.contains(key); });
+
+    std::cout << std::setw(20) << name
+              << std::setw(14) << std::fixed << std::setprecision(1) << insertNs
+              << std::setw(14) << hitNs
+              << std::setw(14) << missNs << std::endl;
+}
+
+// Chained HashMap versus open-addressing RobinHoodHashMap and CuckooHashMap
+static void benchmarkRobinHood(size_t count) {
+    std::cout << "--- HashMap vs RobinHoodHashMap vs CuckooHashMap, " << count << " keys (ns per operation) ---" << std::endl;
+    std::cout << std::setw(20) << "map" << std::setw(14) << "insert" << std::setw(14) << "lookup hit"
+              << std::setw(14) << "lookup miss" << std::endl;
+    benchmarkMap<HashMap<int, std::string>>("HashMap", count);
+    benchmarkMap<RobinHoodHashMap<int, std::string>>("RobinHoodHashMap", count);
+    benchmarkMap<CuckooHashMap<int, std::string>>("CuckooHashMap", count);
+    std::cout << std::endl;
+}
+
+// Average number of list nodes a successful HashSet lookup visits
+static double averageChainProbe(HashSet& set) {
+    size_t total = 0;
+    for (size_t bucket = 0; bucket < set.getTableSize(); bucket++) {
+        size_t length = set.get(static_cast<int>(bucket)).size();
+        total += length * (length + 1) / 2;   // The i-th node of a chain costs i visits
+    }
+    return set.getSize() == 0 ? 0.0 : static_cast<double>(total) / set.getSize();
+}
+
+// Inserts 'count' values, then tests membership of every value (hits) and as many absent values (misses)
+template<typename Set>
+static Set* benchmarkSet(const char* name, size_t count) {
+    std::vector<int> keys = makeKeys(count, 0);
+    std::vector<int> absent = makeKeys(count, 0x80000000u);
+    for (int& key : absent) key = -1 - key;
+    volatile size_t found = 0;
+
+    Set* set = new Set();
+    double insertNs = nanosecondsPerKey(keys, [&](int key) { set->insert(key); });
+    double hitNs = nanosecondsPerKey(keys, [&](int key) { found = found + set->containsValue(key); });
+    double missNs = nanosecondsPerKey(absent, [&](int key) { found = found + set->containsValue(key); });
+
+    std::cout << std::setw(20) << name
+              << std::setw(14) << std::fixed << std::setprecision(1) << insertNs
+              << std::setw(14) << hitNs
+              << std::setw(14) << missNs
+              << std::setw(14) << std::setprecision(2) << 1000.0 / hitNs << std::endl;
+    return set;
+}
+
+// Chained HashSet versus SwissHashSet: throughput and probe lengths
+static void benchmarkSwiss(size_t count) {
+    std::cout << "--- HashSet vs SwissHashSet, " << count << " values (ns per operation) ---" << std::endl;
+    std::cout << std::setw(20) << "set" << std::setw(14) << "insert" << std::setw(14) << "lookup hit"
+              << std::setw(14) << "lookup miss" << std::setw(14) << "hit Mops/s" << std::endl;
+    HashSet* chained = benchmarkSet<HashSet>("HashSet", count);
+    SwissHashSet* swiss = benchmarkSet<SwissHashSet>("SwissHashSet", count);
+
+    std::cout << std::setprecision(2)
+              << "HashSet:      load factor " << chained->getLoadFactor()
+              << ", average nodes visited per hit " << averageChainProbe(*chained) << std::endl
+              << "SwissHashSet: load factor " << swiss->getLoadFactor()
+              << ", average groups probed per hit " << swiss->averageProbeLength()
+              << ", max " << swiss->maxProbeLength() << std::endl << std::endl;
+    delete chained;
+    delete swiss;
+}
+
+// Times every operation separately and prints the mean, the 99.9th percentile and the worst case
+template<typename Operation>
+static void operationLatency(const char* name, const std::vector<int>& keys, Operation operation) {
+    std::vector<double> latencies(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        auto start = std::chrono::steady_clock::now();
+        operation(keys[i]);
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        latencies[i] = elapsed.count();
+    }
+
+    double total = 0;
+    for (double latency : latencies) total += latency;
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << std::setw(28) << name
+              << std::setw(12) << std::fixed << std::setprecision(3) << total / keys.size()
+              << std::setw(12) << latencies[latencies.size() * 999 / 1000]
+              << std::setw(12) << std::setprecision(1) << latencies.back() << std::endl;
+}
+
+// Turns the table around right after a resize: 'keys' are inserted, then keys from
+// 'extra' until the table grows, and every key is removed again (timed), so the removes
+// reach the shrink limit soon after the grow. Half of the keys are inserted once more
+// and removed until the table shrinks; inserting them again (timed) then reaches the
+// grow limit soon after the shrink.
+template<typename Insert, typename Remove, typename TableSize>
+static void growThenShrinkLatency(const std::string& name, const std::vector<int>& keys, const std::vector<int>& extra,
+                                  Insert insert, Remove remove, TableSize tableSize) {
+    std::vector<int> inserted(keys);
+    for (int key : keys) insert(key);
+    size_t buckets = tableSize();
+    for (size_t i = 0; i < extra.size() && tableSize() == buckets; i++) {
+        insert(extra[i]);
+        inserted.push_back(extra[i]);
+    }
+    operationLatency((name + ", removes").c_str(), inserted, remove);
+
+    std::vector<int> half(keys.begin(), keys.begin() + keys.size() / 2);
+    for (int key : half) insert(key);
+    buckets = tableSize();
+    size_t removed = 0;
+    while (removed < half.size() && tableSize() == buckets) {
+        remove(half[removed++]);
+    }
+    std::vector<int> reinserted(half.begin(), half.begin() + removed);
+    operationLatency((name + ", inserts").c_str(), reinserted, insert);
+}
+
+// Per-insert latency with stop-the-world resizing versus incremental resizing
+static void benchmarkIncremental(size_t count) {
+    std::vector<int> keys = makeKeys(count, 0);
+    const std::string value = "value";
+
+    std::cout << "--- Insert latency, " << count << " keys (microseconds) ---" << std::endl;
+    std::cout << std::setw(28) << "table" << std::setw(12) << "mean" << std::setw(12) << "p99.9"
+              << std::setw(12) << "max" << std::endl;
+    for (int incremental = 0; incremental <= 1; incremental++) {
+        HashMap<int, std::string> map;
+        map.setIncrementalResize(incremental != 0);
+        operationLatency(incremental ? "HashMap (incremental)" : "HashMap", keys,
+                      [&](int key) { map.insert(key, value); });
+    }
+    for (int incremental = 0; incremental <= 1; incremental++) {
+        HashSet set;
+        set.setIncrementalResize(incremental != 0);
+        operationLatency(incremental ? "HashSet (incremental)" : "HashSet", keys,
+                      [&](int key) { set.insert(key); });
+    }
+    std::cout << std::endl;
+
+    std::cout << "--- Remove latency after a grow, insert latency after a shrink, " << count
+              << " keys (microseconds) ---" << std::endl;
+    std::cout << std::setw(28) << "table" << std::setw(12) << "mean" << std::setw(12) << "p99.9"
+              << std::setw(12) << "max" << std::endl;
+    std::vector<int> extra = makeKeys(2 * count + 64, 0x40000000u);
+    for (int incremental = 0; incremental <= 1; incremental++) {
+        HashMap<int, std::string> map;
+        map.setIncrementalResize(incremental != 0);
+        growThenShrinkLatency(incremental ? "HashMap (incr.)" : "HashMap", keys, extra,
+                              [&](int key) { map.insert(key, value); }, [&](int key) { map.remove(key); },
+                              [&]() { return map.getTableSize(); });
+    }
+    for (int incremental = 0; incremental <= 1; incremental++) {
+        HashSet set;
+        set.setIncrementalResize(incremental != 0);
+        growThenShrinkLatency(incremental ? "HashSet (incr.)" : "HashSet", keys, extra,
+                              [&](int key) { set.insert(key); }, [&](int key) { set.remove(key); },
+                              [&]() { return set.getTableSize(); });
+    }
+    std::cout << std::endl;
+}
+
+// Bulk load with and without reserve(), and remove/re-insert waves with and without shrinking
+static void benchmarkResizePolicy(size_t count) {
+    std::vector<int> keys = makeKeys(count, 0);
+    std::vector<int> churned(keys.begin(), keys.begin() + count * 3 / 4);
+    const std::string value = "value";
+
+    std::cout << "--- Resize policy, " << count << " keys (ns per operation) ---" << std::endl;
+    for (int reserved = 0; reserved <= 1; reserved++) {
+        HashMap<int, std::string> map;
+        if (reserved) map.reserve(count);
+        double insertNs = nanosecondsPerKey(keys, [&](int key) { map.insert(key, value); });
+        std::cout << std::setw(36) << (reserved ? "bulk insert after reserve()" : "bulk insert")
+                  << std::setw(12) << std::fixed << std::setprecision(1) << insertNs << std::endl;
+    }
+    for (int shrink = 1; shrink >= 0; shrink--) {
+        HashMap<int, std::string> map;
+        map.setAutoShrink(shrink != 0);
+        for (int key : keys) map.insert(key, value);
+
+        // Each wave removes three quarters of the keys and inserts them again
+        double total = 0;
+        for (int wave = 0; wave < 5; wave++) {
+            total += nanosecondsPerKey(churned, [&](int key) { map.remove(key); });
+            total += nanosecondsPerKey(churned, [&](int key) { map.insert(key, value); });
+        }
+        std::cout << std::setw(36) << (shrink ? "churn waves (auto shrink)" : "churn waves (setAutoShrink(false))")
+                  << std::setw(12) << total / 10 << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+// HashMap behind one mutex, the setup ConcurrentHashMap replaces
+class LockedHashMap {
+private:
+    HashMap<int, std::string> map;
+    std::mutex mutex;
+
+public:
+    void insert(int key, const std::string& value) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->map.insert(key, value);
+    }
+
+    void remove(int key) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->map.remove(key);
+    }
+
+    bool tryGet(int key, std::string& value) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        const std::string* stored = this->map.find(key);
+        if (stored == nullptr) return false;
+        value = *stored;
+        return true;
+    }
+};
+
+// Runs 'threads' threads doing 'opsPerThread' random operations each over 'keyRange' keys
+// ('readPercent' lookups, the rest split between inserts and removes); returns Mops/s
+template<typename Map>
+static double runMix(Map& map, int threads, size_t opsPerThread, int keyRange, int readPercent) {
+    const std::string value = "value";
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            uint32_t state = 0x9E3779B9u * (t + 1);
+            std::string copy;
+            for (size_t i = 0; i < opsPerThread; i++) {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                int key = static_cast<int>(state % keyRange);
+                int choice = static_cast<int>((state >> 8) % 100);
+                if (choice < readPercent) {
+                    map.tryGet(key, copy);
+                } else if (choice % 2 == 0) {
+                    map.insert(key, value);
+                } else {
+                    map.remove(key);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    return threads * opsPerThread / elapsed.count();
+}
+
+// Throughput of one locked HashMap versus ConcurrentHashMap from 1 to 64 threads
+static void benchmarkConcurrent(size_t count) {
+    const int keyRange = static_cast<int>(count);
+    const size_t opsPerThread = 100000;
+    const int readMixes[] = {90, 10};
+
+    std::cout << "--- Locked HashMap vs ConcurrentHashMap, " << count << " keys (Mops/s, "
+              << std::thread::hardware_concurrency() << " hardware threads) ---" << std::endl;
+    std::cout << std::setw(10) << "reads %" << std::setw(10) << "threads" << std::setw(16) << "locked HashMap"
+              << std::setw(20) << "ConcurrentHashMap" << std::endl;
+    for (int readPercent : readMixes) {
+        for (int threads = 1; threads <= 64; threads *= 2) {
+            LockedHashMap locked;
+            ConcurrentHashMap<int, std::string> concurrent(64, count);
+            for (int key = 0; key < keyRange; key += 2) {   // Start half full
+                locked.insert(key, "value");
+                concurrent.insert(key, "value");
+            }
+            double lockedRate = runMix(locked, threads, opsPerThread, keyRange, readPercent);
+            double concurrentRate = runMix(concurrent, threads, opsPerThread, keyRange, readPercent);
+            std::cout << std::setw(10) << readPercent << std::setw(10) << threads
+                      << std::setw(16) << std::fixed << std::setprecision(2) << lockedRate
+                      << std::setw(20) << concurrentRate << std::endl;
+        }
+    }
+    std::cout << std::endl;
+}
+
+// Word-count style upserts on string keys: contains + get/insert versus a single tryEmplace,
+// and lookups by std::string_view into a shared buffer versus building a std::string per lookup
+static void benchmarkUpsert(size_t count) {
+    std::vector<std::string> words(count / 4 + 1);
+    std::string buffer;
+    for (size_t i = 0; i < words.size(); i++) {
+        words[i] = "word-" + std::to_string(i * 2654435761u);
+        buffer += words[i];
+    }
+    std::vector<int> picks = makeKeys(count, 7);
+    for (int& pick : picks) pick %= static_cast<int>(words.size());
+
+    std::cout << "--- Upserts and lookups on string keys, " << count << " operations (ns per operation) ---" << std::endl;
+    HashMap<std::string, int> counts;
+    double threeStepNs = nanosecondsPerKey(picks, [&](int pick) {
+        const std::string& word = words[pick];
+        if (counts.contains(word)) {
+            counts.get(word)++;
+        } else {
+            counts.insert(word, 1);
+        }
+    });
+    counts.clear();
+    double tryEmplaceNs = nanosecondsPerKey(picks, [&](int pick) {
+        (*counts.tryEmplace(words[pick], 0).first)++;
+    });
+
+    volatile size_t found = 0;
+    size_t wordLength = words.back().size();
+    const char* tail = buffer.data() + buffer.size() - wordLength;   // Last word, inside the buffer
+    double stringNs = nanosecondsPerKey(picks, [&](int) {
+        found = found + (counts.find(std::string(tail, wordLength)) != nullptr);
+    });
+    double viewNs = nanosecondsPerKey(picks, [&](int) {
+        found = found + (counts.find(std::string_view(tail, wordLength)) != nullptr);
+    });
+
+    std::cout << std::setw(36) << "contains + get/insert" << std::setw(12) << std::fixed << std::setprecision(1) << threeStepNs << std::endl
+              << std::setw(36) << "tryEmplace" << std::setw(12) << tryEmplaceNs << std::endl
+              << std::setw(36) << "find(std::string(buffer))" << std::setw(12) << stringNs << std::endl
+              << std::setw(36) << "find(std::string_view(buffer))" << std::setw(12) << viewNs << std::endl << std::endl;
+}
+
+// Batches of BATCH keys in random order: a loop of single lookups versus one getMany/containsMany
+// per batch. The gap only shows once the table no longer fits in the last-level cache.
+static void benchmarkBatchLookup(size_t count) {
+    const size_t BATCH = 1024;
+    std::vector<int> keys = makeKeys(count, 0);
+    std::vector<int> order = keys;
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));   // Nodes were allocated in key order
+    const std::string value = "value";
+    volatile size_t found = 0;
+
+    HashMap<int, std::string> map;
+    HashSet set;
+    for (int key : keys) {
+        map.insert(key, value);
+        set.insert(key);
+    }
+
+    std::vector<int> batch;
+    std::vector<const std::string*> values;
+    std::vector<bool> present;
+    auto timeBatches = [&](auto lookup) {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t first = 0; first < order.size(); first += BATCH) {
+            batch.assign(order.begin() + first, order.begin() + std::min(first + BATCH, order.size()));
+            lookup();
+        }
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / order.size();
+    };
+
+    double getNs = timeBatches([&] {
+        for (int key : batch) found = found + map.get(key).size();
+    });
+    double getManyNs = timeBatches([&] {
+        map.getMany(batch, values);
+        for (const std::string* stored : values) found = found + stored->size();
+    });
+    double containsNs = timeBatches([&] {
+        for (int key : batch) found = found + set.containsValue(key);
+    });
+    double containsManyNs = timeBatches([&] { found = found + set.containsMany(batch, present); });
+
+    std::cout << "--- Batched lookups, " << count << " keys in batches of " << BATCH << " (ns per key) ---" << std::endl
+              << std::setw(36) << "HashMap get loop" << std::setw(12) << std::fixed << std::setprecision(1) << getNs << std::endl
+              << std::setw(36) << "HashMap getMany" << std::setw(12) << getManyNs
+              << "  (" << std::setprecision(2) << getNs / getManyNs << "x)" << std::endl
+              << std::setw(36) << "HashSet containsValue loop" << std::setw(12) << std::setprecision(1) << containsNs << std::endl
+              << std::setw(36) << "HashSet containsMany" << std::setw(12) << containsManyNs
+              << "  (" << std::setprecision(2) << containsNs / containsManyNs << "x)" << std::endl << std::endl;
+}
+
+// Negative-heavy membership tests against a HashSet: direct containsValue versus a Bloom or
+// cuckoo filter screening out most misses first. 95% of the probes are absent.
+template<typename Filter>
+static void benchmarkFilter(const char* name, const HashSet& set, const std::vector<int>& keys,
+                            const std::vector<int>& probes, const std::vector<int>& absent, double rate) {
+    volatile size_t found = 0;
+    Filter filter(keys.size(), rate);
+    double buildNs = nanosecondsPerKey(keys, [&](int key) { filter.insert(key); });
+    double filterNs = nanosecondsPerKey(probes, [&](int key) { found = found + filter.mightContain(key); });
+    double screenedNs = nanosecondsPerKey(probes, [&](int key) {
+        found = found + (filter.mightContain(key) && set.containsValue(key));
+    });
+    size_t falsePositives = 0;
+    for (int key : absent) {
+        falsePositives += filter.mightContain(key);
+    }
+
+    std::cout << std::setw(22) << name << std::setw(8) << std::setprecision(3) << rate * 100 << "%"
+              << std::setw(10) << std::setprecision(3) << 100.0 * falsePositives / absent.size() << "%"
+              << std::setw(12) << std::setprecision(2) << 8.0 * filter.getMemoryBytes() / keys.size()
+              << std::setw(10) << std::setprecision(1) << buildNs
+              << std::setw(10) << filterNs
+              << std::setw(12) << screenedNs << std::endl;
+}
+
+static void benchmarkFilters(size_t count) {
+    std::vector<int> keys = makeKeys(count, 0);
+    std::vector<int> absent = makeKeys(count, 0x80000000u);
+    for (int& key : absent) key = -1 - key;
+    std::vector<int> probes(count);
+    for (size_t i = 0; i < count; i++) {
+        probes[i] = i % 20 == 0 ? keys[(i * 7919) % count] : absent[i];
+    }
+    std::shuffle(probes.begin(), probes.end(), std::mt19937(7));
+
+    HashSet set;
+    for (int key : keys) set.insert(key);
+    volatile size_t found = 0;
+    double directNs = nanosecondsPerKey(probes, [&](int key) { found = found + set.containsValue(key); });
+
+    std::cout << "--- Filters in front of HashSet, " << count << " values, 95% negative probes ---" << std::endl
+              << "HashSet containsValue alone: " << std::fixed << std::setprecision(1) << directNs << " ns per probe" << std::endl
+              << std::setw(22) << "Filter" << std::setw(9) << "target" << std::setw(11) << "measured"
+              << std::setw(12) << "bits/value" << std::setw(10) << "insert" << std::setw(10) << "probe"
+              << std::setw(12) << "screened" << std::endl;
+    for (double rate : {0.01, 0.001}) {
+        benchmarkFilter<BlockedBloomFilter>("BlockedBloomFilter", set, keys, probes, absent, rate);
+        benchmarkFilter<CuckooFilter>("CuckooFilter", set, keys, probes, absent, rate);
+    }
+    std::cout << "(insert/probe/screened in ns; screened = mightContain, then containsValue on a maybe)" << std::endl << std::endl;
+}
+
+// Times every lookup separately (random order, all hits) and prints percentiles in nanoseconds.
+// Each sample includes the cost of reading the clock, the same for every table.
+template<typename Lookup>
+static void lookupLatency(const char* name, const std::vector<int>& keys, Lookup lookup) {
+    std::vector<double> latencies(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        auto start = std::chrono::steady_clock::now();
+        lookup(keys[i]);
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        latencies[i] = elapsed.count();
+    }
+
+    double total = 0;
+    for (double latency : latencies) total += latency;
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << std::setw(20) << name
+              << std::setw(10) << std::fixed << std::setprecision(1) << total / keys.size()
+              << std::setw(10) << latencies[latencies.size() / 2]
+              << std::setw(10) << latencies[latencies.size() * 99 / 100]
+              << std::setw(10) << latencies[latencies.size() * 999 / 1000]
+              << std::setw(12) << latencies.back() << std::endl;
+}
+
+// Lookup tail latency: chained HashMap, RobinHoodHashMap and CuckooHashMap (at most two buckets)
+static void benchmarkLookupLatency(size_t count) {
+    std::vector<int> keys = makeKeys(count, 0);
+    std::vector<int> order = keys;
+    std::shuffle(order.begin(), order.end(), std::mt19937(11));
+    const std::string value = "value";
+    volatile size_t found = 0;
+
+    std::cout << "--- Lookup latency, " << count << " keys (nanoseconds) ---" << std::endl;
+    std::cout << std::setw(20) << "table" << std::setw(10) << "mean" << std::setw(10) << "p50"
+              << std::setw(10) << "p99" << std::setw(10) << "p99.9" << std::setw(12) << "max" << std::endl;
+    {
+        HashMap<int, std::string> map;
+        for (int key : keys) map.insert(key, value);
+        lookupLatency("HashMap", order, [&](int key) { found = found + map.get(key).size(); });
+    }
+    {
+        RobinHoodHashMap<int, std::string> map;
+        for (int key : keys) map.insert(key, value);
+        lookupLatency("RobinHoodHashMap", order, [&](int key) { found = found + map.get(key).size(); });
+    }
+    {
+        CuckooHashMap<int, std::string> map;
+        for (int key : keys) map.insert(key, value);
+        lookupLatency("CuckooHashMap", order, [&](int key) { found = found + map.get(key).size(); });
+        std::cout << std::setw(20) << "" << "(cuckoo load " << std::setprecision(2) << map.getLoadFactor()
+                  << ", stash " << map.getStashSize() << ")" << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+// Heap bytes currently allocated, where the C library can report them (0 otherwise)
+static size_t heapBytesInUse() {
+#if defined(__GLIBC__) && defined(__GLIBC_PREREQ)
+#if __GLIBC_PREREQ(2, 33)
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;   // Arena chunks plus large mmap-ed blocks
+#endif
+#endif
+    return 0;
+}
+
+// Tens of millions of short strings: HashMap<std::string, std::string> versus StringArenaMap
+static void benchmarkStringArena(size_t count) {
+    std::vector<int> keys = makeKeys(count, 0);
+    std::vector<int> order = keys;
+    std::shuffle(order.begin(), order.end(), std::mt19937(13));
+    volatile size_t found = 0;
+    auto keyOf = [](int key) { return "user:" + std::to_string(key); };
+    auto valueOf = [](int key) { return "session-" + std::to_string(key * 7u); };
+
+    std::cout << "--- String keys and values, " << count << " entries ---" << std::endl;
+    std::cout << std::setw(36) << "map" << std::setw(14) << "heap bytes" << std::setw(14) << "per entry"
+              << std::setw(12) << "insert ns" << std::setw(12) << "lookup ns" << std::endl;
+    {
+        size_t heapBefore = heapBytesInUse();
+        HashMap<std::string, std::string> map;
+        double insertNs = nanosecondsPerKey(keys, [&](int key) { map.insert(keyOf(key), valueOf(key)); });
+        size_t heap = heapBytesInUse() - heapBefore;
+        double lookupNs = nanosecondsPerKey(order, [&](int key) { found = found + map.get(keyOf(key)).size(); });
+        std::cout << std::setw(36) << "HashMap<std::string, std::string>" << std::setw(14) << heap
+                  << std::setw(14) << std::fixed << std::setprecision(1) << static_cast<double>(heap) / count
+                  << std::setw(12) << insertNs << std::setw(12) << lookupNs << std::endl;
+    }
+    {
+        size_t heapBefore = heapBytesInUse();
+        StringArenaMap map;
+        double insertNs = nanosecondsPerKey(keys, [&](int key) { map.insert(keyOf(key), valueOf(key)); });
+        size_t heap = heapBytesInUse() - heapBefore;
+        double lookupNs = nanosecondsPerKey(order, [&](int key) { found = found + map.get(keyOf(key)).size(); });
+        std::cout << std::setw(36) << "StringArenaMap" << std::setw(14) << heap
+                  << std::setw(14) << static_cast<double>(heap) / count
+                  << std::setw(12) << insertNs << std::setw(12) << lookupNs << std::endl;
+        std::cout << std::setw(36) << "" << "(arena " << map.getArenaBytes() << " bytes, "
+                  << map.getTableSize() << " slots)" << std::endl;
+    }
+    std::cout << "(heap bytes from mallinfo2; 0 where it is unavailable. Lookups build the key string, as callers would.)"
+              << std::endl << std::endl;
+}
+
+// Milliseconds taken by one call of 'operation'
+template<typename Operation>
+static double millisecondsFor(Operation operation) {
+    auto start = std::chrono::steady_clock::now();
+    operation();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+// Warm start: rebuilding a HashMap<int, std::string> by inserting every record, against
+// loading a snapshot of it and against opening the snapshot as a mapped view
+static void benchmarkSnapshot(size_t count) {
+    const std::string path = "benchmark.snapshot";
+    std::vector<int> keys = makeKeys(count, 0);
+    std::vector<int> order = keys;
+    std::shuffle(order.begin(), order.end(), std::mt19937(17));
+    volatile size_t found = 0;
+
+    std::cout << "--- Snapshots of a HashMap<int, std::string>, " << count << " entries (ms) ---" << std::endl;
+    HashMap<int, std::string> source;
+    double insertMs = millisecondsFor([&]() {
+        for (int key : keys) {
+            source.insert(key, "value " + std::to_string(key));
+        }
+    });
+    double saveMs = millisecondsFor([&]() { source.saveSnapshot(path); });
+
+    HashMap<int, std::string> loaded;
+    double loadMs = millisecondsFor([&]() { loaded.loadSnapshot(path); });
+    double viewMs = millisecondsFor([&]() {
+        HashMapSnapshotView<int, std::string> view(path);
+        found = found + view.getSize();
+    });
+    double viewUncheckedMs = millisecondsFor([&]() {
+        HashMapSnapshotView<int, std::string> view(path, false);
+        found = found + view.getSize();
+    });
+
+    std::cout << std::fixed << std::setprecision(1)
+              << std::setw(44) << "rebuild with insert: " << insertMs << std::endl
+              << std::setw(44) << "saveSnapshot: " << saveMs << std::endl
+              << std::setw(44) << "loadSnapshot: " << loadMs << std::endl
+              << std::setw(44) << "open HashMapSnapshotView (checksum): " << viewMs << std::endl
+              << std::setw(44) << "open HashMapSnapshotView (no checksum): " << viewUncheckedMs << std::endl;
+
+    HashMapSnapshotView<int, std::string> view(path);
+    double mapNs = nanosecondsPerKey(order, [&](int key) { found = found + loaded.get(key).size(); });
+    double viewNs = nanosecondsPerKey(order, [&](int key) {
+        std::string_view value;
+        found = found + (view.tryGet(key, value) ? value.size() : 0);
+    });
+    std::cout << std::setw(44) << "lookup ns, loaded HashMap: " << mapNs << std::endl
+              << std::setw(44) << "lookup ns, HashMapSnapshotView: " << viewNs << std::endl << std::endl;
+    std::remove(path.c_str());
+}
+
+// Layout statistics of HashMap and RobinHoodHashMap after 'count' inserts, and the
+// collision rate of hash functions on random and strided keys
+static void benchmarkStats(size_t count) {
+    std::vector<int> keys = makeKeys(count, 0);
+    std::cout << "--- Table statistics, " << count << " keys ---" << std::endl;
+
+    HashMap<int, std::string> map;
+    for (int key : keys) {
+        map.insert(key, "value");
+    }
+    std::cout << "HashMap<int, std::string>:" << std::endl;
+    map.getStats().print();
+
+    RobinHoodHashMap<int, std::string> robinHood;
+    for (int key : keys) {
+        robinHood.insert(key, "value");
+    }
+    std::cout << "RobinHoodHashMap<int, std::string>:" << std::endl;
+    robinHood.getStats().print();
+
+    // Strided keys (multiples of 16, distinct up to 10^8 keys) defeat a hash that keeps
+    // the low bits of the key
+    std::vector<int> strided(count);
+    for (size_t i = 0; i < count; i++) {
+        strided[i] = static_cast<int>(i * 16);
+    }
+    size_t buckets = 1;
+    while (buckets < count * 10 / 7) {
+        buckets *= 2;
+    }
+    double load = static_cast<double>(count) / buckets;
+    std::cout << "Collision rate over " << buckets << " buckets (uniform hash: "
+              << 1 - (1 - std::exp(-load)) / load << "):" << std::endl;
+    std::cout << std::setw(20) << "hash" << std::setw(14) << "random keys" << std::setw(14) << "strided" << std::endl;
+    std::cout << std::setw(20) << "IntHash" << std::setw(14) << bucketCollisionRate(keys, buckets, IntHash())
+              << std::setw(14) << bucketCollisionRate(strided, buckets, IntHash()) << std::endl;
+    std::cout << std::setw(20) << "std::hash<int>" << std::setw(14) << bucketCollisionRate(keys, buckets, std::hash<int>())
+              << std::setw(14) << bucketCollisionRate(strided, buckets, std::hash<int>()) << std::endl << std::endl;
+}
+
+// A map built once and then only read: HashMap against the StaticHashMap built from it
+static void benchmarkStaticMap(size_t count) {
+    std::vector<int> keys = makeKeys(count, 0);
+    std::vector<int> order = keys;
+    std::shuffle(order.begin(), order.end(), std::mt19937(19));
+    std::vector<int> absent = makeKeys(count, 0x80000000u);
+    for (int& key : absent) key = -1 - key;
+    volatile size_t found = 0;
+
+    std::cout << "--- HashMap vs StaticHashMap (minimal perfect hash), " << count << " keys ---" << std::endl;
+    size_t heapBefore = heapBytesInUse();
+    HashMap<int, std::string> map;
+    for (int key : keys) {
+        map.insert(key, "value");
+    }
+    size_t mapBytes = heapBytesInUse() - heapBefore;
+
+    StaticHashMap<int, std::string>* staticMap = nullptr;
+    double buildMs = millisecondsFor([&]() { staticMap = new StaticHashMap<int, std::string>(map); });
+
+    std::cout << std::setw(20) << "map" << std::setw(14) << "bytes/key" << std::setw(14) << "lookup hit"
+              << std::setw(14) << "lookup miss" << std::endl;
+    double hitNs = nanosecondsPerKey(order, [&](int key) { found = found + (map.find(key) != nullptr); });
+    double missNs = nanosecondsPerKey(absent, [&](int key) { found = found + (map.find(key) != nullptr); });
+    std::cout << std::setw(20) << "HashMap" << std::setw(14) << std::fixed << std::setprecision(1)
+              << (mapBytes == 0 ? 0.0 : static_cast<double>(mapBytes) / count)
+              << std::setw(14) << hitNs << std::setw(14) << missNs << std::endl;
+    hitNs = nanosecondsPerKey(order, [&](int key) { found = found + (staticMap->find(key) != nullptr); });
+    missNs = nanosecondsPerKey(absent, [&](int key) { found = found + (staticMap->find(key) != nullptr); });
+    std::cout << std::setw(20) << "StaticHashMap" << std::setw(14)
+              << static_cast<double>(staticMap->getMemoryBytes()) / count
+              << std::setw(14) << hitNs << std::setw(14) << missNs << std::endl;
+    std::cout << "(build " << buildMs << " ms, " << std::setprecision(2) << staticMap->getBitsPerKey()
+              << " bits of pilots and remap per key; HashMap bytes from mallinfo2, 0 where unavailable)"
+              << std::endl << std::endl;
+    delete staticMap;
+}
+
+// Two sets of 'count' values sharing half of them. The loops are what a caller would
+// write without the bulk operations; the "all threads" rows split the lookups
+// over the hardware threads (no gain on a single-core machine).
+static void benchmarkSetAlgebra(size_t count) {
+    std::vector<int> keys = makeKeys(count + count / 2, 0);
+    HashSet first, second;
+    first.reserve(count);
+    second.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        first.insert(keys[i]);
+        second.insert(keys[i + count / 2]);
+    }
+    size_t threads = std::thread::hardware_concurrency();
+    threads = threads == 0 ? 1 : threads;
+    volatile size_t result = 0;
+
+    std::cout << "--- HashSet set algebra, 2 x " << count << " values, half shared, "
+              << threads << " hardware threads ---" << std::endl;
+    std::cout << std::setw(36) << "operation" << std::setw(12) << "ms" << std::endl;
+    auto row = [](const char* name, double ms) {
+        std::cout << std::setw(36) << name << std::setw(12) << std::fixed << std::setprecision(1) << ms << std::endl;
+    };
+    row("loop of containsValue", millisecondsFor([&]() {
+        size_t shared = 0;
+        for (int value : first) {
+            shared += second.containsValue(value);
+        }
+        result = shared;
+    }));
+    row("intersectionSize, 1 thread", millisecondsFor([&]() { result = first.intersectionSize(second); }));
+    row("intersectionSize, all threads", millisecondsFor([&]() { result = first.intersectionSize(second, threads); }));
+
+    // Each operation runs on its own copy of the first set
+    auto onCopy = [&](const char* name, const std::function<void(HashSet&)>& operation) {
+        HashSet copy = first;
+        row(name, millisecondsFor([&]() { operation(copy); }));
+    };
+    onCopy("loop of insert (union)", [&](HashSet& set) {
+        for (int value : second) {
+            set.insert(value);
+        }
+    });
+    onCopy("unionWith, all threads", [&](HashSet& set) { set.unionWith(second, threads); });
+    onCopy("intersectWith, all threads", [&](HashSet& set) { set.intersectWith(second, threads); });
+    onCopy("differenceWith, all threads", [&](HashSet& set) { set.differenceWith(second, threads); });
+    std::cout << std::endl;
+}
+
+// Synthetic trace of 'length' accesses to keys 0..keys - 1 with Zipfian popularity: the
+// key of rank r is drawn with probability proportional to 1 / r^exponent. Ranks are
+// mapped to scattered keys, so popular keys do not share a shard.
+static std::vector<int> zipfianTrace(size_t keys, size_t length, double exponent, uint32_t seed) {
+    std::vector<double> cumulative(keys);
+    double total = 0;
+    for (size_t rank = 0; rank < keys; rank++) {
+        total += 1.0 / std::pow(static_cast<double>(rank + 1), exponent);
+        cumulative[rank] = total;
+    }
+    std::vector<int> scattered = makeKeys(keys, 0);
+    std::mt19937_64 random(seed);
+    std::uniform_real_distribution<double> uniform(0, total);
+    std::vector<int> trace(length);
+    for (int& key : trace) {
+        size_t rank = std::lower_bound(cumulative.begin(), cumulative.end(), uniform(random)) - cumulative.begin();
+        key = scattered[rank < keys ? rank : keys - 1];
+    }
+    return trace;
+}
+
+// Replays the trace over 'threads' threads, each taking a contiguous part: a miss loads
+// the key (here a constant string) and puts it. Returns millions of accesses per second.
+static double replayTrace(ConcurrentCache<int, std::string>& cache, const std::vector<int>& trace, size_t threads) {
+    const std::string value = "value";
+    std::vector<std::thread> workers;
+    size_t part = (trace.size() + threads - 1) / threads;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            std::string copy;
+            size_t end = (t + 1) * part < trace.size() ? (t + 1) * part : trace.size();
+            for (size_t i = t * part; i < end; i++) {
+                if (!cache.tryGet(trace[i], copy)) {
+                    cache.put(trace[i], value);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    return trace.size() / elapsed.count();
+}
+
+// Hit rate and throughput of the three eviction policies on Zipfian traces over 'count'
+// keys, with room for 1% of them. The same trace is replayed by 1 thread, then by the
+// hardware threads (the order of accesses, and so the hit rate, then varies slightly).
+static void benchmarkCache(size_t count) {
+    const size_t capacity = count / 100 < 64 ? 64 : count / 100;
+    const double exponents[] = {0.8, 1.0};
+    const EvictionPolicy policies[] = {EvictionPolicy::LRU, EvictionPolicy::CLOCK, EvictionPolicy::TINY_LFU};
+    const char* names[] = {"LRU", "CLOCK", "W-TinyLFU"};
+    size_t threads = std::thread::hardware_concurrency();
+    threads = threads == 0 ? 1 : threads;
+
+    std::cout << "--- ConcurrentCache, Zipfian traces of " << count << " accesses over " << count
+              << " keys, capacity " << capacity << " (Mops/s, " << threads << " hardware threads) ---" << std::endl;
+    std::cout << std::setw(10) << "zipf" << std::setw(12) << "policy" << std::setw(12) << "hit rate"
+              << std::setw(12) << "1 thread" << std::setw(14) << "all threads" << std::endl;
+    for (double exponent : exponents) {
+        std::vector<int> trace = zipfianTrace(count, count, exponent, 42);
+        for (size_t p = 0; p < 3; p++) {
+            ConcurrentCache<int, std::string> cache(capacity, policies[p]);
+            replayTrace(cache, trace, 1);   // Warm up: fill the cache and the sketch
+            cache.resetCounters();
+            double single = replayTrace(cache, trace, 1);
+            double hitRate = cache.getCounters().getHitRate();
+            double parallel = replayTrace(cache, trace, threads);
+            std::cout << std::setw(10) << std::fixed << std::setprecision(1) << exponent << std::setw(12) << names[p]
+                      << std::setw(12) << std::setprecision(3) << hitRate << std::setw(12) << std::setprecision(2)
+                      << single << std::setw(14) << parallel << std::endl;
+        }
+    }
+    std::cout << std::endl;
+}
+
+// Full-table scans of a HashMap: summing the key and value lengths of every entry
+// through forEach, an iterator loop, and parallelForEach with one accumulator per
+// worker. Each scan runs three times; the fastest run is shown.
+static void benchmarkScan(size_t count) {
+    std::vector<int> keys = makeKeys(count, 0);
+    HashMap<int, std::string> map;
+    map.reserve(count);
+    for (int key : keys) {
+        map.insert(key, "value");
+    }
+    size_t threads = std::thread::hardware_concurrency();
+    threads = threads == 0 ? 1 : threads;
+    volatile uint64_t result = 0;
+
+    std::cout << "--- HashMap full scan, " << count << " entries, " << threads << " hardware threads ---" << std::endl;
+    std::cout << std::setw(30) << "scan" << std::setw(12) << "ms" << std::endl;
+    auto row = [](const char* name, double ms) {
+        std::cout << std::setw(30) << name << std::setw(12) << std::fixed << std::setprecision(1) << ms << std::endl;
+    };
+    auto bestOfThree = [](const std::function<void()>& scan) {
+        double best = millisecondsFor(scan);
+        for (int run = 1; run < 3; run++) {
+            best = std::min(best, millisecondsFor(scan));
+        }
+        return best;
+    };
+    row("forEach", bestOfThree([&]() {
+        uint64_t sum = 0;
+        map.forEach([&sum](const int& key, const std::string& value) { sum += static_cast<uint64_t>(key) + value.size(); });
+        result = sum;
+    }));
+    row("iterator loop", bestOfThree([&]() {
+        uint64_t sum = 0;
+        for (const auto& pair : map) {
+            sum += static_cast<uint64_t>(pair.first) + pair.second.size();
+        }
+        result = sum;
+    }));
+    std::vector<size_t> workerCounts = {1};
+    if (threads > 1) {
+        workerCounts.push_back(threads);
+    }
+    for (size_t workers : workerCounts) {
+        // Accumulators on separate cache lines, so workers do not share one
+        std::vector<uint64_t> sums(workers * 8, 0);
+        double ms = bestOfThree([&]() {
+            std::fill(sums.begin(), sums.end(), 0);
+            map.parallelForEach([&sums](size_t worker, const int& key, const std::string& value) {
+                sums[worker * 8] += static_cast<uint64_t>(key) + value.size();
+            }, workers);
+            uint64_t sum = 0;
+            for (size_t worker = 0; worker < workers; worker++) {
+                sum += sums[worker * 8];
+            }
+            result = sum;
+        });
+        std::string name = "parallelForEach, " + std::to_string(workers) + (workers == 1 ? " thread" : " threads");
+        row(name.c_str(), ms);
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    // Usage: ./benchmark [keyCount ...], e.g. ./benchmark 1000000 10000000 100000000
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; i++) {
+        sizes.push_back(static_cast<size_t>(std::atoll(argv[i])));
+    }
+    if (sizes.empty()) {
+        sizes.push_back(1000000);
+    }
+
+    for (size_t count : sizes) {
+        benchmarkRobinHood(count);
+        benchmarkSwiss(count);
+        benchmarkIncremental(count);
+        benchmarkResizePolicy(count);
+        benchmarkUpsert(count);
+        benchmarkBatchLookup(count);
+        benchmarkFilters(count);
+        benchmarkLookupLatency(count);
+        benchmarkStringArena(count);
+        benchmarkSnapshot(count);
+        benchmarkStats(count);
+        benchmarkStaticMap(count);
+        benchmarkSetAlgebra(count);
+        benchmarkCache(count);
+        benchmarkScan(count);
+        benchmarkConcurrent(count);
+    }
+    return 0;
+}
@@ -0,0 +1,133 @@
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint32_t, uint64_t
+#include <cmath>     // For std::exp, std::log, std::lgamma, std::pow, std::sqrt
+#include <stdexcept>
+#include <vector>
+#include "blockedBloomFilter.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BLOOM_USE_AVX2 1
+#endif
+
+const size_t BlockedBloomFilter::WORDS_PER_BLOCK;
+
+// Odd constants multiplied with the low half of the hash; the top 5 bits of each
+// product pick the bit set in the corresponding word
+alignas(32) static const uint32_t SALTS[8] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+    0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U
+};
+
+// Hash function: IntHash mixed a second time. A false positive needs dozens of hash bits to
+// collide, and one multiply leaves patterned keys (i * 7 against -i) measurably correlated.
+uint64_t BlockedBloomFilter::hashFunction(const int& value) {
+    return hashing::hashMix(IntHash()(value) ^ hashing::SECRET2, hashing::SECRET3);
+};
+
+size_t BlockedBloomFilter::blockIndex(uint64_t hash) const {
+    return static_cast<size_t>(((hash >> 32) * static_cast<uint64_t>(this->blocks.size())) >> 32);
+};
+
+// Block loads follow a Poisson distribution with mean count / blockCount; a block
+// holding i values answers a foreign query with "maybe" when all 8 probed bits are
+// set, i.e. with probability (1 - (1 - 1/32)^i)^8.
+double BlockedBloomFilter::falsePositiveRateFor(size_t blockCount, size_t count) {
+    double mean = static_cast<double>(count) / blockCount;
+    size_t lastLoad = static_cast<size_t>(mean + 12 * std::sqrt(mean) + 30);
+    double rate = 0;
+    for (size_t i = 1; i <= lastLoad; i++) {
+        double probability = std::exp(-mean + i * std::log(mean) - std::lgamma(i + 1.0));
+        double bitSet = 1 - std::pow(1 - 1.0 / 32, static_cast<double>(i));
+        rate += probability * std::pow(bitSet, static_cast<double>(WORDS_PER_BLOCK));
+    }
+    return rate;
+};
+
+// Constructor: Finds the smallest block count meeting the target rate (the rate only
+// falls as blocks are added, so a doubling search followed by a binary search does)
+BlockedBloomFilter::BlockedBloomFilter(size_t expectedCount, double falsePositiveRate)
+    : numElements(0), targetFalsePositiveRate(falsePositiveRate) {
+    if (!(falsePositiveRate > 0 && falsePositiveRate < 1)) {
+        throw std::invalid_argument("False positive rate must be between 0 and 1");
+    }
+    size_t high = 1;
+    while (expectedCount > 0 && falsePositiveRateFor(high, expectedCount) > falsePositiveRate) {
+        high *= 2;
+    }
+    size_t low = high / 2 + 1;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (falsePositiveRateFor(middle, expectedCount) > falsePositiveRate) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    this->blocks.assign(high, BloomBlock());
+};
+
+// insert: ORs one bit into each of the eight words of the value's block
+void BlockedBloomFilter::insert(const int& value) {
+    uint64_t hash = hashFunction(value);
+    BloomBlock& block = this->blocks[this->blockIndex(hash)];
+    uint32_t key = static_cast<uint32_t>(hash);
+#ifdef BLOOM_USE_AVX2
+    __m256i products = _mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(key)),
+                                          _mm256_load_si256(reinterpret_cast<const __m256i*>(SALTS)));
+    __m256i bits = _mm256_sllv_epi32(_mm256_set1_epi32(1), _mm256_srli_epi32(products, 27));
+    __m256i* words = reinterpret_cast<__m256i*>(block.words);
+    _mm256_store_si256(words, _mm256_or_si256(_mm256_load_si256(words), bits));
+#else
+    for (size_t i = 0; i < WORDS_PER_BLOCK; i++) {
+        block.words[i] |= 1U << ((key * SALTS[i]) >> 27);
+    }
+#endif
+    this->numElements++;
+};
+
+// mightContain: Tests the same eight bits; with AVX2 one vptest checks them all
+bool BlockedBloomFilter::mightContain(const int& value) const {
+    uint64_t hash = hashFunction(value);
+    const BloomBlock& block = this->blocks[this->blockIndex(hash)];
+    uint32_t key = static_cast<uint32_t>(hash);
+#ifdef BLOOM_USE_AVX2
+    __m256i products = _mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(key)),
+                                          _mm256_load_si256(reinterpret_cast<const __m256i*>(SALTS)));
+    __m256i bits = _mm256_sllv_epi32(_mm256_set1_epi32(1), _mm256_srli_epi32(products, 27));
+    __m256i words = _mm256_load_si256(reinterpret_cast<const __m256i*>(block.words));
+    return _mm256_testc_si256(words, bits) != 0;
+#else
+    // No early exit: the eight tests are independent, so the compiler can vectorise them
+    uint32_t missing = 0;
+    for (size_t i = 0; i < WORDS_PER_BLOCK; i++) {
+        missing |= ~block.words[i] & (1U << ((key * SALTS[i]) >> 27));
+    }
+    return missing == 0;
+#endif
+};
+
+void BlockedBloomFilter::clear() {
+    this->blocks.assign(this->blocks.size(), BloomBlock());
+    this->numElements = 0;
+};
+
+size_t BlockedBloomFilter::getSize() const {
+    return this->numElements;
+};
+
+size_t BlockedBloomFilter::getBlockCount() const {
+    return this->blocks.size();
+};
+
+size_t BlockedBloomFilter::getMemoryBytes() const {
+    return this->blocks.size() * sizeof(BloomBlock);
+};
+
+double BlockedBloomFilter::estimatedFalsePositiveRate() const {
+    return falsePositiveRateFor(this->blocks.size(), this->numElements);
+};
+
+double BlockedBloomFilter::getTargetFalsePositiveRate() const {
+    return this->targetFalsePositiveRate;
+};
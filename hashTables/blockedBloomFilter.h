@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint32_t, uint64_t
+#include <vector>
+#include "hashFunctions.h"
+
+// One block of the filter: 256 bits as eight 32-bit words, aligned so that a
+// block never straddles a cache line and loads as a single AVX2 register.
+struct alignas(32) BloomBlock {
+    uint32_t words[8];
+};
+
+// Split-block Bloom filter of ints (the layout used by Impala, Kudu and Parquet).
+//
+// A value's hash picks one block, and sets (or tests) exactly one bit in each of
+// the block's eight words. A query therefore reads a single cache line, and the
+// eight bit positions are computed with eight independent multiplies, which map
+// onto one AVX2 multiply/shift/test sequence when the code is built with -mavx2.
+// There are no false negatives. The false positive rate chosen in the constructor
+// holds as long as at most 'expectedCount' values are inserted.
+class BlockedBloomFilter {
+private:
+    static const size_t WORDS_PER_BLOCK = 8;
+
+    std::vector<BloomBlock> blocks;
+    size_t numElements;              // Values inserted (duplicates count again)
+    double targetFalsePositiveRate;
+
+    // Hash function (IntHash, mixed twice): the high 32 bits select the block, the low 32 bits the bits
+    static uint64_t hashFunction(const int& value);
+
+    // Block index in [0, blocks.size()) from the high half of the hash (multiply-shift, no division)
+    size_t blockIndex(uint64_t hash) const;
+
+    // Expected false positive rate of 'blockCount' blocks holding 'count' values
+    static double falsePositiveRateFor(size_t blockCount, size_t count);
+
+public:
+    // Constructor: Sizes the filter so that 'expectedCount' values give at most
+    // 'falsePositiveRate' false positives. Throws std::invalid_argument unless 0 < rate < 1.
+    explicit BlockedBloomFilter(size_t expectedCount, double falsePositiveRate = 0.01);
+
+    // insert: Adds the value
+    void insert(const int& value);
+
+    // mightContain: false means the value was never inserted; true means it probably was
+    bool mightContain(const int& value) const;
+
+    // clear: Resets every bit
+    void clear();
+
+    // getSize: Returns the number of insert calls since construction or clear
+    size_t getSize() const;
+
+    size_t getBlockCount() const;
+
+    size_t getMemoryBytes() const;
+
+    // estimatedFalsePositiveRate: Expected rate for the values inserted so far
+    double estimatedFalsePositiveRate() const;
+
+    double getTargetFalsePositiveRate() const;
+};
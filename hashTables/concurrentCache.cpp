@@ -0,0 +1,416 @@
+#include <algorithm> // For std::fill
+#include <atomic>
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint32_t, uint64_t
+#include <functional>
+#include <memory>    // For std::unique_ptr
+#include <mutex>     // For std::unique_lock
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "concurrentCache.h"
+
+template class ConcurrentCache<int, std::string>;
+template class ConcurrentCache<std::string, std::string>;
+
+// One word (16 counters) per key, rounded up to a power of two; the four rows share
+// the table
+FrequencySketch::FrequencySketch(size_t keys) : sampleLimit(10 * (keys < 1 ? 1 : keys)), samples(0) {
+    size_t words = 8;
+    while (words < keys) {
+        words *= 2;
+    }
+    this->table.assign(words, 0);
+};
+
+// Each row hashes the key again with its own seed: the high bits pick the word, the
+// low four bits the counter in it
+void FrequencySketch::counterOf(uint64_t hash, size_t row, size_t& word, size_t& shift) const {
+    uint64_t rowHash = hashing::hashMix(hash ^ (hashing::SECRET0 * (row + 1)), hashing::SECRET2);
+    word = static_cast<size_t>(rowHash >> 32) & (this->table.size() - 1);
+    shift = static_cast<size_t>(rowHash & 15) * 4;
+};
+
+void FrequencySketch::increment(uint64_t hash) {
+    for (size_t row = 0; row < 4; row++) {
+        size_t word, shift;
+        this->counterOf(hash, row, word, shift);
+        if (((this->table[word] >> shift) & 15) < 15) {
+            this->table[word] += static_cast<uint64_t>(1) << shift;
+        }
+    }
+    if (++this->samples >= this->sampleLimit) {
+        // Halves every counter at once: shift each word right and drop the bit that
+        // crossed into the neighbouring counter
+        for (uint64_t& word : this->table) {
+            word = (word >> 1) & 0x7777777777777777ULL;
+        }
+        this->samples /= 2;
+    }
+};
+
+uint32_t FrequencySketch::estimate(uint64_t hash) const {
+    uint32_t count = 15;
+    for (size_t row = 0; row < 4; row++) {
+        size_t word, shift;
+        this->counterOf(hash, row, word, shift);
+        uint32_t counter = static_cast<uint32_t>((this->table[word] >> shift) & 15);
+        count = counter < count ? counter : count;
+    }
+    return count;
+};
+
+void FrequencySketch::clear() {
+    std::fill(this->table.begin(), this->table.end(), 0);
+    this->samples = 0;
+};
+
+CacheCounters::CacheCounters() : hits(0), misses(0), evictions(0), rejections(0) { };
+
+double CacheCounters::getHitRate() const {
+    uint64_t lookups = this->hits + this->misses;
+    return lookups == 0 ? 0.0 : static_cast<double>(this->hits) / lookups;
+};
+
+template<typename KeyType, typename ValueType, typename Hasher>
+typename ConcurrentCache<KeyType, ValueType, Hasher>::Shard&
+ConcurrentCache<KeyType, ValueType, Hasher>::shardFor(uint64_t hash) const {
+    return this->shards[static_cast<size_t>(hash >> 40) & (this->shardCount - 1)];
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+void ConcurrentCache<KeyType, ValueType, Hasher>::pushFront(Shard& shard, uint8_t list, uint32_t slot) {
+    SlotList& target = shard.lists[list];
+    Slot& entry = shard.slots[slot];
+    entry.list = list;
+    entry.prev = NO_SLOT;
+    entry.next = target.front;
+    if (target.front != NO_SLOT) {
+        shard.slots[target.front].prev = slot;
+    } else {
+        target.back = slot;
+    }
+    target.front = slot;
+    target.size++;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+void ConcurrentCache<KeyType, ValueType, Hasher>::unlink(Shard& shard, uint32_t slot) {
+    Slot& entry = shard.slots[slot];
+    SlotList& source = shard.lists[entry.list];
+    if (entry.prev != NO_SLOT) {
+        shard.slots[entry.prev].next = entry.next;
+    } else {
+        source.front = entry.next;
+    }
+    if (entry.next != NO_SLOT) {
+        shard.slots[entry.next].prev = entry.prev;
+    } else {
+        source.back = entry.prev;
+    }
+    source.size--;
+}
+
+// LRU moves the entry to the front. TINY_LFU counts the access and moves the entry to
+// the front of its area; a probation entry hit again is promoted to protected, which
+// demotes protected's oldest entry to probation when protected is full.
+template<typename KeyType, typename ValueType, typename Hasher>
+void ConcurrentCache<KeyType, ValueType, Hasher>::touch(Shard& shard, uint32_t slot) {
+    Slot& entry = shard.slots[slot];
+    if (this->policy == EvictionPolicy::CLOCK) {
+        entry.referenced.store(true, std::memory_order_relaxed);
+        return;
+    }
+    uint8_t list = entry.list;
+    if (this->policy == EvictionPolicy::TINY_LFU) {
+        shard.sketch->increment(entry.hash);
+        if (list == PROBATION) {
+            list = PROTECTED;
+        }
+    }
+    this->unlink(shard, slot);
+    this->pushFront(shard, list, slot);
+    if (shard.lists[PROTECTED].size > shard.protectedCapacity) {
+        uint32_t demoted = shard.lists[PROTECTED].back;
+        this->unlink(shard, demoted);
+        this->pushFront(shard, PROBATION, demoted);
+    }
+}
+
+// The slot's key and value are reset so that they release any memory they own
+template<typename KeyType, typename ValueType, typename Hasher>
+void ConcurrentCache<KeyType, ValueType, Hasher>::release(Shard& shard, uint32_t slot) {
+    Slot& entry = shard.slots[slot];
+    shard.index.remove(entry.key);
+    if (this->policy != EvictionPolicy::CLOCK) {
+        this->unlink(shard, slot);
+    }
+    entry.key = KeyType();
+    entry.value = ValueType();
+    shard.freeSlots.push_back(slot);
+}
+
+// A full LRU shard evicts the back of its list. A full CLOCK shard sweeps the hand over
+// the slots, clearing reference bits, and evicts the first entry whose bit is clear.
+template<typename KeyType, typename ValueType, typename Hasher>
+uint32_t ConcurrentCache<KeyType, ValueType, Hasher>::takeSlot(Shard& shard) {
+    if (shard.index.getSize() >= shard.capacity && this->policy != EvictionPolicy::TINY_LFU) {
+        uint32_t victim;
+        if (this->policy == EvictionPolicy::LRU) {
+            victim = shard.lists[WINDOW].back;
+        } else {
+            while (shard.slots[shard.clockHand].referenced.load(std::memory_order_relaxed)) {
+                shard.slots[shard.clockHand].referenced.store(false, std::memory_order_relaxed);
+                shard.clockHand = shard.clockHand + 1 == shard.capacity ? 0 : shard.clockHand + 1;
+            }
+            victim = static_cast<uint32_t>(shard.clockHand);
+            shard.clockHand = shard.clockHand + 1 == shard.capacity ? 0 : shard.clockHand + 1;
+        }
+        this->release(shard, victim);
+        shard.evictions++;
+    }
+    if (!shard.freeSlots.empty()) {
+        uint32_t slot = shard.freeSlots.back();
+        shard.freeSlots.pop_back();
+        return slot;
+    }
+    return static_cast<uint32_t>(shard.used++);
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+void ConcurrentCache<KeyType, ValueType, Hasher>::admitFromWindow(Shard& shard) {
+    uint32_t candidate = NO_SLOT;
+    if (shard.lists[WINDOW].size > shard.windowCapacity) {
+        candidate = shard.lists[WINDOW].back;
+        this->unlink(shard, candidate);
+        this->pushFront(shard, PROBATION, candidate);
+    }
+    if (shard.index.getSize() <= shard.capacity) {
+        return;
+    }
+
+    // The main area's oldest entry: probation's back, or protected's if probation only
+    // holds the candidate
+    uint32_t victim = shard.lists[PROBATION].back;
+    if (victim == candidate || victim == NO_SLOT) {
+        victim = shard.lists[PROTECTED].back;
+    }
+    if (victim == NO_SLOT) {
+        victim = candidate;
+    } else if (candidate != NO_SLOT
+               && shard.sketch->estimate(shard.slots[candidate].hash) <= shard.sketch->estimate(shard.slots[victim].hash)) {
+        victim = candidate;
+        shard.rejections++;
+    }
+    this->release(shard, victim);
+    shard.evictions++;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+bool ConcurrentCache<KeyType, ValueType, Hasher>::lookup(Shard& shard, const KeyType& key, uint64_t hash,
+                                                         ValueType& value) {
+    const uint32_t* slot = shard.index.find(key);
+    if (slot == nullptr) {
+        if (this->policy == EvictionPolicy::TINY_LFU) {
+            shard.sketch->increment(hash);   // Misses count too: they decide admission later
+        }
+        shard.misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    this->touch(shard, *slot);
+    value = shard.slots[*slot].value;
+    shard.hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// Constructor: shard i gets capacity / shardCount slots, plus one for the first
+// capacity % shardCount shards
+template<typename KeyType, typename ValueType, typename Hasher>
+ConcurrentCache<KeyType, ValueType, Hasher>::ConcurrentCache(size_t capacity, EvictionPolicy policy, size_t shardCount)
+    : shardCount(1), capacity(capacity), policy(policy) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Cache capacity must be positive");
+    }
+    while (this->shardCount < shardCount) {
+        this->shardCount *= 2;
+    }
+    while (this->shardCount > 1 && capacity / this->shardCount < 64) {
+        this->shardCount /= 2;
+    }
+    if (capacity / this->shardCount + 1 >= NO_SLOT) {
+        throw std::invalid_argument("Cache capacity too large for the number of shards");
+    }
+
+    this->shards.reset(new Shard[this->shardCount]);
+    for (size_t i = 0; i < this->shardCount; i++) {
+        Shard& shard = this->shards[i];
+        shard.capacity = capacity / this->shardCount + (i < capacity % this->shardCount ? 1 : 0);
+        shard.slots.reset(new Slot[shard.capacity + 1]);
+        shard.index.reserve(shard.capacity + 1);
+        shard.used = 0;
+        for (SlotList& list : shard.lists) {
+            list = SlotList{NO_SLOT, NO_SLOT, 0};
+        }
+        // W-TinyLFU proportions: a window of 1% of the entries, and 80% of the main
+        // area for protected entries
+        shard.windowCapacity = shard.capacity / 100 < 1 ? 1 : shard.capacity / 100;
+        shard.protectedCapacity = (shard.capacity - shard.windowCapacity) * 8 / 10;
+        shard.clockHand = 0;
+        if (policy == EvictionPolicy::TINY_LFU) {
+            shard.sketch.reset(new FrequencySketch(shard.capacity));
+        }
+        shard.hits = 0;
+        shard.misses = 0;
+        shard.evictions = 0;
+        shard.rejections = 0;
+    }
+}
+
+// CLOCK hits only set a reference bit, so they share the lock; the other policies
+// reorder their lists on every hit
+template<typename KeyType, typename ValueType, typename Hasher>
+bool ConcurrentCache<KeyType, ValueType, Hasher>::tryGet(const KeyType& key, ValueType& value) {
+    uint64_t hash = this->hasher(key);
+    Shard& shard = this->shardFor(hash);
+    if (this->policy == EvictionPolicy::CLOCK) {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        return this->lookup(shard, key, hash, value);
+    }
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return this->lookup(shard, key, hash, value);
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+void ConcurrentCache<KeyType, ValueType, Hasher>::put(const KeyType& key, const ValueType& value) {
+    uint64_t hash = this->hasher(key);
+    Shard& shard = this->shardFor(hash);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    uint32_t* existing = shard.index.find(key);
+    if (existing != nullptr) {
+        shard.slots[*existing].value = value;
+        this->touch(shard, *existing);
+        return;
+    }
+
+    uint32_t slot = this->takeSlot(shard);
+    Slot& entry = shard.slots[slot];
+    entry.key = key;
+    entry.value = value;
+    entry.hash = hash;
+    entry.referenced.store(false, std::memory_order_relaxed);
+    shard.index.insert(key, slot);
+    if (this->policy == EvictionPolicy::LRU) {
+        this->pushFront(shard, WINDOW, slot);
+    } else if (this->policy == EvictionPolicy::TINY_LFU) {
+        shard.sketch->increment(hash);
+        this->pushFront(shard, WINDOW, slot);
+        this->admitFromWindow(shard);
+    }
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+ValueType ConcurrentCache<KeyType, ValueType, Hasher>::getOrLoad(const KeyType& key,
+                                                                 const std::function<ValueType(const KeyType&)>& load) {
+    ValueType value;
+    if (this->tryGet(key, value)) {
+        return value;
+    }
+    value = load(key);
+    this->put(key, value);
+    return value;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+bool ConcurrentCache<KeyType, ValueType, Hasher>::remove(const KeyType& key) {
+    Shard& shard = this->shardFor(this->hasher(key));
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    const uint32_t* slot = shard.index.find(key);
+    if (slot == nullptr) {
+        return false;
+    }
+    this->release(shard, *slot);
+    return true;
+}
+
+// Checks the key without counting a hit or miss or touching the entry
+template<typename KeyType, typename ValueType, typename Hasher>
+bool ConcurrentCache<KeyType, ValueType, Hasher>::contains(const KeyType& key) const {
+    const Shard& shard = this->shardFor(this->hasher(key));
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.index.contains(key);
+}
+
+// Empties every shard, one at a time; the counters are kept
+template<typename KeyType, typename ValueType, typename Hasher>
+void ConcurrentCache<KeyType, ValueType, Hasher>::clear() {
+    for (size_t i = 0; i < this->shardCount; i++) {
+        Shard& shard = this->shards[i];
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.index.clear();
+        for (size_t slot = 0; slot < shard.used; slot++) {
+            shard.slots[slot].key = KeyType();
+            shard.slots[slot].value = ValueType();
+        }
+        shard.used = 0;
+        shard.freeSlots.clear();
+        for (SlotList& list : shard.lists) {
+            list = SlotList{NO_SLOT, NO_SLOT, 0};
+        }
+        shard.clockHand = 0;
+        if (shard.sketch) {
+            shard.sketch->clear();
+        }
+    }
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t ConcurrentCache<KeyType, ValueType, Hasher>::getSize() const {
+    size_t size = 0;
+    for (size_t i = 0; i < this->shardCount; i++) {
+        std::shared_lock<std::shared_mutex> lock(this->shards[i].mutex);
+        size += this->shards[i].index.getSize();
+    }
+    return size;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t ConcurrentCache<KeyType, ValueType, Hasher>::getCapacity() const {
+    return this->capacity;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t ConcurrentCache<KeyType, ValueType, Hasher>::getShardCount() const {
+    return this->shardCount;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+EvictionPolicy ConcurrentCache<KeyType, ValueType, Hasher>::getPolicy() const {
+    return this->policy;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+CacheCounters ConcurrentCache<KeyType, ValueType, Hasher>::getCounters() const {
+    CacheCounters counters;
+    for (size_t i = 0; i < this->shardCount; i++) {
+        const Shard& shard = this->shards[i];
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        counters.hits += shard.hits.load(std::memory_order_relaxed);
+        counters.misses += shard.misses.load(std::memory_order_relaxed);
+        counters.evictions += shard.evictions;
+        counters.rejections += shard.rejections;
+    }
+    return counters;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+void ConcurrentCache<KeyType, ValueType, Hasher>::resetCounters() {
+    for (size_t i = 0; i < this->shardCount; i++) {
+        Shard& shard = this->shards[i];
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.hits = 0;
+        shard.misses = 0;
+        shard.evictions = 0;
+        shard.rejections = 0;
+    }
+}
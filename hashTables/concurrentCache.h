@@ -0,0 +1,188 @@
+#pragma once
+#include <atomic>
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint8_t, uint32_t, uint64_t
+#include <functional>
+#include <memory>    // For std::unique_ptr
+#include <shared_mutex>
+#include <vector>
+#include "hashFunctions.h"
+#include "hashMap.h"
+
+// How a full cache picks the entry to drop for a new one
+enum class EvictionPolicy {
+    LRU,        // The least recently used entry
+    CLOCK,      // An entry not used since the clock hand last passed it (approximates LRU)
+    TINY_LFU    // W-TinyLFU: a small LRU window, then admission by estimated frequency
+};
+
+// Approximate access counts of the recently seen keys (TinyLFU): a count-min sketch
+// of four rows of 4-bit counters, 16 counters to a 64-bit word. Counts saturate at
+// 15, and every counter is halved after 10 samples per tracked key, so keys that were
+// popular long ago fade out.
+class FrequencySketch {
+private:
+    std::vector<uint64_t> table;   // A power of two of words
+    size_t sampleLimit;            // Samples between two halvings
+    size_t samples;
+
+    // Word and nibble of the counter of 'hash' in row 'row'
+    void counterOf(uint64_t hash, size_t row, size_t& word, size_t& shift) const;
+
+public:
+    // Constructor: sized to tell apart the frequencies of about 'keys' keys
+    explicit FrequencySketch(size_t keys);
+
+    // increment: Counts one access to the key with this hash
+    void increment(uint64_t hash);
+
+    // estimate: The access count of the key, at most 15; never below the true count
+    // since the last halving
+    uint32_t estimate(uint64_t hash) const;
+
+    void clear();
+};
+
+// Hit, miss and eviction counts of a cache, summed over its shards
+struct CacheCounters {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;     // Entries dropped to make room, including rejected newcomers
+    uint64_t rejections;    // TINY_LFU only: new entries evicted because they were rarer than the victim
+
+    CacheCounters();
+
+    double getHitRate() const;
+};
+
+// Bounded, thread-safe cache in front of a slow store. Entries live in a fixed array
+// of 'capacity' slots, and a HashMap indexes the slots by key; when every slot is
+// taken, the eviction policy chooses which entry a new one replaces.
+//
+// The cache is split into shards, as ConcurrentHashMap is. Each shard has its own
+// lock, slots, policy state and counters, and evicts among its own entries only. A
+// CLOCK hit only sets the entry's reference bit, so CLOCK hits take the shard's lock
+// in shared mode and run in parallel; LRU and TINY_LFU hits reorder lists and take it
+// exclusively. Values are returned by copy.
+template<typename KeyType, typename ValueType, typename Hasher = DefaultHash<KeyType>>
+class ConcurrentCache {
+private:
+    static const uint32_t NO_SLOT = 0xFFFFFFFF;
+
+    // Lists a slot can be on. LRU uses WINDOW only; TINY_LFU has a window LRU in
+    // front of a segmented LRU (probation, then protected for entries hit again).
+    static const uint8_t WINDOW = 0;
+    static const uint8_t PROBATION = 1;
+    static const uint8_t PROTECTED = 2;
+
+    struct Slot {
+        KeyType key;
+        ValueType value;
+        uint64_t hash;
+        uint32_t prev;                    // Neighbours on the slot's list, towards the front
+        uint32_t next;                    // ... and towards the back
+        uint8_t list;
+        std::atomic<bool> referenced;     // CLOCK: used since the hand last passed
+    };
+
+    // Doubly linked list of slot indices, most recently used at the front
+    struct SlotList {
+        uint32_t front;
+        uint32_t back;
+        size_t size;
+    };
+
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        HashMap<KeyType, uint32_t, Hasher> index;   // Key -> slot
+        std::unique_ptr<Slot[]> slots;              // capacity + 1: TINY_LFU admits before it evicts
+        size_t capacity;
+        size_t used;                                // Slots 0..used - 1 have been handed out
+        std::vector<uint32_t> freeSlots;            // Slots of removed entries
+        SlotList lists[3];
+        size_t windowCapacity;                      // TINY_LFU: WINDOW and PROTECTED limits
+        size_t protectedCapacity;
+        size_t clockHand;
+        std::unique_ptr<FrequencySketch> sketch;    // TINY_LFU only
+        std::atomic<uint64_t> hits;
+        std::atomic<uint64_t> misses;
+        uint64_t evictions;
+        uint64_t rejections;
+    };
+
+    std::unique_ptr<Shard[]> shards;
+    size_t shardCount;    // Always a power of two
+    size_t capacity;
+    EvictionPolicy policy;
+    Hasher hasher;
+
+    // Shard of a hash: bits 40 and up, as in ConcurrentHashMap
+    Shard& shardFor(uint64_t hash) const;
+
+    void pushFront(Shard& shard, uint8_t list, uint32_t slot);
+
+    void unlink(Shard& shard, uint32_t slot);
+
+    // Marks a hit on an entry (the shard is locked exclusively, except for CLOCK)
+    void touch(Shard& shard, uint32_t slot);
+
+    // Removes the entry of the slot from the index and its list, and frees the slot
+    void release(Shard& shard, uint32_t slot);
+
+    // A free slot for a new entry, evicting one if the shard is full (LRU and CLOCK)
+    uint32_t takeSlot(Shard& shard);
+
+    // TINY_LFU, after a new entry joined the window: an overfull window passes its
+    // oldest entry to the main area, and an overfull shard then evicts either that
+    // entry or the main area's oldest one, whichever the sketch counts less often
+    void admitFromWindow(Shard& shard);
+
+    // Finds the key in a locked shard, counting the hit or miss
+    bool lookup(Shard& shard, const KeyType& key, uint64_t hash, ValueType& value);
+
+public:
+    // Constructor: 'capacity' entries in total, split evenly over the shards.
+    // 'shardCount' is rounded up to a power of two, then lowered until every shard has
+    // at least 64 slots, so a small cache still evicts by a meaningful order.
+    // Throws std::invalid_argument if 'capacity' is 0 or above 2^32 - 2 per shard.
+    explicit ConcurrentCache(size_t capacity, EvictionPolicy policy = EvictionPolicy::LRU,
+                             size_t shardCount = 16);
+
+    ~ConcurrentCache() = default;
+
+    ConcurrentCache(const ConcurrentCache&) = delete;
+    ConcurrentCache& operator=(const ConcurrentCache&) = delete;
+
+    // tryGet: Copies the cached value into 'value' and counts a hit; counts a miss
+    // and returns false if the key is not cached
+    bool tryGet(const KeyType& key, ValueType& value);
+
+    // put: Caches the pair, replacing the value of a cached key. A new key may evict
+    // another entry or, with TINY_LFU, be rejected later in favour of a more frequent one.
+    void put(const KeyType& key, const ValueType& value);
+
+    // getOrLoad: The cached value, or on a miss the value 'load' returns, which is then
+    // cached. 'load' runs without the lock held, so two threads missing the same key
+    // at the same moment may both call it.
+    ValueType getOrLoad(const KeyType& key, const std::function<ValueType(const KeyType&)>& load);
+
+    // remove: Drops the key from the cache; returns false if it was not cached
+    bool remove(const KeyType& key);
+
+    bool contains(const KeyType& key) const;
+
+    void clear();
+
+    size_t getSize() const;
+
+    size_t getCapacity() const;
+
+    size_t getShardCount() const;
+
+    EvictionPolicy getPolicy() const;
+
+    // getCounters: Hits, misses and evictions since construction (or resetCounters)
+    CacheCounters getCounters() const;
+
+    void resetCounters();
+};
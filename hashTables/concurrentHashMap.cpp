@@ -0,0 +1,127 @@
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint64_t
+#include <iostream>
+#include <memory>    // For std::unique_ptr
+#include <mutex>     // For std::unique_lock
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include "concurrentHashMap.h"
+
+template class ConcurrentHashMap<int, std::string>;
+
+// Picks the shard from bits 40 and up of the hash, leaving the low bits to the shard's buckets.
+template<typename KeyType, typename ValueType, typename Hasher>
+typename ConcurrentHashMap<KeyType, ValueType, Hasher>::Shard&
+ConcurrentHashMap<KeyType, ValueType, Hasher>::shardFor(const KeyType& key) const {
+    return this->shards[static_cast<size_t>(this->hasher(key) >> 40) & (this->shardCount - 1)];
+}
+
+// Constructor rounds the shard count up to a power of two and presizes every shard.
+template<typename KeyType, typename ValueType, typename Hasher>
+ConcurrentHashMap<KeyType, ValueType, Hasher>::ConcurrentHashMap(size_t shardCount, size_t expectedSize)
+    : shardCount(1) {
+    while (this->shardCount < shardCount) {
+        this->shardCount *= 2;
+    }
+    this->shards.reset(new Shard[this->shardCount]);
+    for (size_t i = 0; i < this->shardCount; i++) {
+        this->shards[i].map.reserve(expectedSize / this->shardCount);
+    }
+}
+
+// Inserts under the shard's exclusive lock; existing keys keep their value, as in HashMap.
+template<typename KeyType, typename ValueType, typename Hasher>
+bool ConcurrentHashMap<KeyType, ValueType, Hasher>::insert(const KeyType& key, const ValueType& value) {
+    Shard& shard = this->shardFor(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.tryEmplace(key, value).second;
+}
+
+// Inserts the pair, or overwrites the value if the key exists.
+template<typename KeyType, typename ValueType, typename Hasher>
+bool ConcurrentHashMap<KeyType, ValueType, Hasher>::upsert(const KeyType& key, const ValueType& value) {
+    Shard& shard = this->shardFor(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.insertOrAssign(key, value).second;
+}
+
+// Removes the key under the shard's exclusive lock.
+template<typename KeyType, typename ValueType, typename Hasher>
+bool ConcurrentHashMap<KeyType, ValueType, Hasher>::remove(const KeyType& key) {
+    Shard& shard = this->shardFor(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    size_t sizeBefore = shard.map.getSize();
+    shard.map.remove(key);
+    return shard.map.getSize() != sizeBefore;
+}
+
+// Returns a copy of the value for the given key; throws if not found.
+template<typename KeyType, typename ValueType, typename Hasher>
+ValueType ConcurrentHashMap<KeyType, ValueType, Hasher>::get(const KeyType& key) const {
+    ValueType value;
+    if (!this->tryGet(key, value)) {
+        throw std::out_of_range("Key not found");
+    }
+    return value;
+}
+
+// Copies the value under the shard's shared lock, so readers do not block each other.
+template<typename KeyType, typename ValueType, typename Hasher>
+bool ConcurrentHashMap<KeyType, ValueType, Hasher>::tryGet(const KeyType& key, ValueType& value) const {
+    const Shard& shard = this->shardFor(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    const ValueType* stored = shard.map.find(key);
+    if (stored == nullptr) {
+        return false;
+    }
+    value = *stored;
+    return true;
+}
+
+// Checks if the key exists under the shard's shared lock.
+template<typename KeyType, typename ValueType, typename Hasher>
+bool ConcurrentHashMap<KeyType, ValueType, Hasher>::contains(const KeyType& key) const {
+    const Shard& shard = this->shardFor(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.contains(key);
+}
+
+// Clears every shard, one at a time.
+template<typename KeyType, typename ValueType, typename Hasher>
+void ConcurrentHashMap<KeyType, ValueType, Hasher>::clear() {
+    for (size_t i = 0; i < this->shardCount; i++) {
+        std::unique_lock<std::shared_mutex> lock(this->shards[i].mutex);
+        this->shards[i].map.clear();
+    }
+}
+
+// Returns the number of key-value pairs (exact when no writer is running).
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t ConcurrentHashMap<KeyType, ValueType, Hasher>::getSize() const {
+    size_t size = 0;
+    for (size_t i = 0; i < this->shardCount; i++) {
+        std::shared_lock<std::shared_mutex> lock(this->shards[i].mutex);
+        size += this->shards[i].map.getSize();
+    }
+    return size;
+}
+
+// Returns the number of shards.
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t ConcurrentHashMap<KeyType, ValueType, Hasher>::getShardCount() const {
+    return this->shardCount;
+}
+
+// Prints the non-empty shards for debugging.
+template<typename KeyType, typename ValueType, typename Hasher>
+void ConcurrentHashMap<KeyType, ValueType, Hasher>::print() const {
+    for (size_t i = 0; i < this->shardCount; i++) {
+        std::shared_lock<std::shared_mutex> lock(this->shards[i].mutex);
+        if (this->shards[i].map.getSize() == 0) {
+            continue;
+        }
+        std::cout << "Shard " << i << " (" << this->shards[i].map.getSize() << " elements):" << std::endl;
+        this->shards[i].map.print();
+    }
+}
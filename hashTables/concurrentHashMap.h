@@ -0,0 +1,71 @@
+#pragma once
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint64_t
+#include <memory>    // For std::unique_ptr
+#include <shared_mutex>
+#include "hashFunctions.h"
+#include "hashMap.h"
+
+// Thread-safe hash map built from independently locked shards.
+// The top bits of a key's hash pick its shard; each shard is a HashMap guarded by
+// its own reader-writer lock, so readers of a shard run in parallel and writers
+// only block operations on the same shard. Values are returned by copy: a
+// reference would outlive the lock that protects it.
+//
+// All member functions may be called concurrently, except the constructor and
+// destructor. getSize() and print() lock one shard at a time, so under
+// concurrent writes they see each shard at a slightly different moment.
+template<typename KeyType, typename ValueType, typename Hasher = DefaultHash<KeyType>>
+class ConcurrentHashMap {
+private:
+    // One independently locked part of the map, on its own cache lines so that
+    // locking one shard does not invalidate the lock word of its neighbours
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        HashMap<KeyType, ValueType, Hasher> map;
+    };
+
+    std::unique_ptr<Shard[]> shards;
+    size_t shardCount;    // Always a power of two
+    Hasher hasher;
+
+    // Shard owning a key: bits 40 and up of the hash, the buckets inside a
+    // shard use the low bits
+    Shard& shardFor(const KeyType& key) const;
+
+public:
+    // Constructor: 'shardCount' is rounded up to a power of two; each shard is
+    // presized for its share of 'expectedSize' elements
+    explicit ConcurrentHashMap(size_t shardCount = 64, size_t expectedSize = 0);
+
+    ~ConcurrentHashMap() = default;
+
+    ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+    ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+    // insert: Adds the pair if the key is absent; returns false if it was present
+    bool insert(const KeyType& key, const ValueType& value);
+
+    // upsert: Inserts the pair or overwrites the value of an existing key;
+    // returns true if the key was new
+    bool upsert(const KeyType& key, const ValueType& value);
+
+    // remove: Removes the key; returns false if it was absent
+    bool remove(const KeyType& key);
+
+    // get: Returns a copy of the value of the key; throws if not found
+    ValueType get(const KeyType& key) const;
+
+    // tryGet: Copies the value of the key into 'value'; returns false if not found
+    bool tryGet(const KeyType& key, ValueType& value) const;
+
+    bool contains(const KeyType& key) const;
+
+    void clear();
+
+    size_t getSize() const;
+
+    size_t getShardCount() const;
+
+    void print() const;
+};
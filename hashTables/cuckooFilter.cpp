@@ -0,0 +1,232 @@
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint32_t, uint64_t
+#include <cmath>     // For std::ceil, std::log2, std::pow
+#include <stdexcept>
+#include <vector>
+#include "cuckooFilter.h"
+
+const size_t CuckooFilter::SLOTS_PER_BUCKET;
+const size_t CuckooFilter::MAX_KICKS;
+
+// Hash function: IntHash plus a second hashMix round, so the fingerprints of patterned
+// keys are as independent as the rate computed in the constructor assumes
+uint64_t CuckooFilter::hashFunction(const int& value) {
+    return hashing::hashMix(IntHash()(value) ^ hashing::SECRET2, hashing::SECRET3);
+};
+
+uint32_t CuckooFilter::fingerprintOf(uint64_t hash) const {
+    uint32_t fingerprint = static_cast<uint32_t>(hash >> 32) & ((1U << this->fingerprintBits) - 1);
+    return fingerprint == 0 ? 1 : fingerprint;
+};
+
+// XOR with a hash of the fingerprint is its own inverse, so either bucket leads to the other
+size_t CuckooFilter::alternateBucket(size_t bucket, uint32_t fingerprint) const {
+    return (bucket ^ static_cast<size_t>(IntHash()(fingerprint))) & (this->numBuckets - 1);
+};
+
+// Bucket b starts at bit b * 4 * fingerprintBits; it may span two words
+uint64_t CuckooFilter::readBucket(size_t bucket) const {
+    size_t bucketBits = SLOTS_PER_BUCKET * this->fingerprintBits;
+    size_t offset = bucket * bucketBits;
+    size_t word = offset / 64, shift = offset % 64;
+    uint64_t contents = this->bits[word] >> shift;
+    if (shift + bucketBits > 64) {
+        contents |= this->bits[word + 1] << (64 - shift);
+    }
+    return bucketBits == 64 ? contents : contents & ((1ULL << bucketBits) - 1);
+};
+
+void CuckooFilter::writeBucket(size_t bucket, uint64_t contents) {
+    size_t bucketBits = SLOTS_PER_BUCKET * this->fingerprintBits;
+    uint64_t mask = bucketBits == 64 ? ~0ULL : (1ULL << bucketBits) - 1;
+    size_t offset = bucket * bucketBits;
+    size_t word = offset / 64, shift = offset % 64;
+    this->bits[word] = (this->bits[word] & ~(mask << shift)) | (contents << shift);
+    if (shift + bucketBits > 64) {
+        size_t spill = 64 - shift;
+        this->bits[word + 1] = (this->bits[word + 1] & ~(mask >> spill)) | (contents >> spill);
+    }
+};
+
+// Classic "has a zero field" test on contents XOR the broadcast fingerprint: a field
+// becomes zero exactly where the fingerprint matches, and subtracting 1 from each field
+// borrows into its top bit only if the field was zero.
+bool CuckooFilter::bucketHas(uint64_t contents, uint32_t fingerprint) const {
+    uint64_t difference = contents ^ (this->lowBits * fingerprint);
+    return ((difference - this->lowBits) & ~difference & this->highBits) != 0;
+};
+
+bool CuckooFilter::insertIntoBucket(size_t bucket, uint32_t fingerprint) {
+    uint64_t contents = this->readBucket(bucket);
+    uint64_t slotMask = (1ULL << this->fingerprintBits) - 1;
+    for (size_t slot = 0; slot < SLOTS_PER_BUCKET; slot++) {
+        size_t shift = slot * this->fingerprintBits;
+        if (((contents >> shift) & slotMask) == 0) {
+            this->writeBucket(bucket, contents | (static_cast<uint64_t>(fingerprint) << shift));
+            return true;
+        }
+    }
+    return false;
+};
+
+bool CuckooFilter::removeFromBucket(size_t bucket, uint32_t fingerprint) {
+    uint64_t contents = this->readBucket(bucket);
+    uint64_t slotMask = (1ULL << this->fingerprintBits) - 1;
+    for (size_t slot = 0; slot < SLOTS_PER_BUCKET; slot++) {
+        size_t shift = slot * this->fingerprintBits;
+        if (((contents >> shift) & slotMask) == fingerprint) {
+            this->writeBucket(bucket, contents & ~(slotMask << shift));
+            return true;
+        }
+    }
+    return false;
+};
+
+uint64_t CuckooFilter::nextRandom() {
+    this->randomState ^= this->randomState << 13;
+    this->randomState ^= this->randomState >> 7;
+    this->randomState ^= this->randomState << 17;
+    return this->randomState;
+};
+
+// Constructor: A lookup compares against up to 2 * 4 fingerprints, each matching with
+// probability 1 / 2^f, so f = ceil(log2(8 / rate)) bits meet the rate (kept within 4..16)
+CuckooFilter::CuckooFilter(size_t capacity, double falsePositiveRate)
+    : numBuckets(2), numElements(0), targetFalsePositiveRate(falsePositiveRate),
+      hasVictim(false), victimFingerprint(0), victimBucket(0), randomState(0x9E3779B97F4A7C15ULL) {
+    if (!(falsePositiveRate > 0 && falsePositiveRate < 1)) {
+        throw std::invalid_argument("False positive rate must be between 0 and 1");
+    }
+    double wantedBits = std::ceil(std::log2(2.0 * SLOTS_PER_BUCKET / falsePositiveRate));
+    this->fingerprintBits = wantedBits < 4 ? 4 : wantedBits > 16 ? 16 : static_cast<size_t>(wantedBits);
+
+    double wantedBuckets = std::ceil(capacity / (SLOTS_PER_BUCKET * MAX_LOAD_FACTOR));
+    while (this->numBuckets < wantedBuckets) {
+        this->numBuckets *= 2;
+    }
+    this->lowBits = 0;
+    for (size_t slot = 0; slot < SLOTS_PER_BUCKET; slot++) {
+        this->lowBits |= 1ULL << (slot * this->fingerprintBits);
+    }
+    this->highBits = this->lowBits << (this->fingerprintBits - 1);
+
+    size_t totalBits = this->numBuckets * SLOTS_PER_BUCKET * this->fingerprintBits;
+    this->bits.assign(totalBits / 64 + 1, 0);
+};
+
+// insert: Tries both buckets, then evicts random fingerprints to their other bucket
+bool CuckooFilter::insert(const int& value) {
+    if (this->hasVictim) {
+        return false;
+    }
+    uint64_t hash = hashFunction(value);
+    uint32_t fingerprint = this->fingerprintOf(hash);
+    size_t bucket = static_cast<size_t>(hash) & (this->numBuckets - 1);
+    size_t alternate = this->alternateBucket(bucket, fingerprint);
+    this->numElements++;
+    if (this->insertIntoBucket(bucket, fingerprint) || this->insertIntoBucket(alternate, fingerprint)) {
+        return true;
+    }
+
+    if (this->nextRandom() & 1) {
+        bucket = alternate;
+    }
+    for (size_t kick = 0; kick < MAX_KICKS; kick++) {
+        size_t shift = (this->nextRandom() % SLOTS_PER_BUCKET) * this->fingerprintBits;
+        uint64_t slotMask = (1ULL << this->fingerprintBits) - 1;
+        uint64_t contents = this->readBucket(bucket);
+        uint32_t evicted = static_cast<uint32_t>((contents >> shift) & slotMask);
+        this->writeBucket(bucket, (contents & ~(slotMask << shift)) | (static_cast<uint64_t>(fingerprint) << shift));
+
+        fingerprint = evicted;
+        bucket = this->alternateBucket(bucket, fingerprint);
+        if (this->insertIntoBucket(bucket, fingerprint)) {
+            return true;
+        }
+    }
+    // The value itself is stored; keep the homeless fingerprint so nothing is lost
+    this->hasVictim = true;
+    this->victimFingerprint = fingerprint;
+    this->victimBucket = bucket;
+    return true;
+};
+
+bool CuckooFilter::mightContain(const int& value) const {
+    uint64_t hash = hashFunction(value);
+    uint32_t fingerprint = this->fingerprintOf(hash);
+    size_t bucket = static_cast<size_t>(hash) & (this->numBuckets - 1);
+    size_t alternate = this->alternateBucket(bucket, fingerprint);
+
+    if (this->hasVictim && this->victimFingerprint == fingerprint
+        && (this->victimBucket == bucket || this->victimBucket == alternate)) {
+        return true;
+    }
+    // Both buckets are read before either is tested, so their cache misses overlap
+    uint64_t first = this->readBucket(bucket);
+    uint64_t second = this->readBucket(alternate);
+    return this->bucketHas(first, fingerprint) | this->bucketHas(second, fingerprint);
+};
+
+// remove: A freed slot may let the kept-aside fingerprint back into the table
+bool CuckooFilter::remove(const int& value) {
+    uint64_t hash = hashFunction(value);
+    uint32_t fingerprint = this->fingerprintOf(hash);
+    size_t bucket = static_cast<size_t>(hash) & (this->numBuckets - 1);
+    size_t alternate = this->alternateBucket(bucket, fingerprint);
+
+    if (this->removeFromBucket(bucket, fingerprint) || this->removeFromBucket(alternate, fingerprint)) {
+        this->numElements--;
+        if (this->hasVictim) {
+            size_t victimAlternate = this->alternateBucket(this->victimBucket, this->victimFingerprint);
+            if (this->insertIntoBucket(this->victimBucket, this->victimFingerprint)
+                || this->insertIntoBucket(victimAlternate, this->victimFingerprint)) {
+                this->hasVictim = false;
+            }
+        }
+        return true;
+    }
+    if (this->hasVictim && this->victimFingerprint == fingerprint
+        && (this->victimBucket == bucket || this->victimBucket == alternate)) {
+        this->hasVictim = false;
+        this->numElements--;
+        return true;
+    }
+    return false;
+};
+
+void CuckooFilter::clear() {
+    this->bits.assign(this->bits.size(), 0);
+    this->numElements = 0;
+    this->hasVictim = false;
+};
+
+size_t CuckooFilter::getSize() const {
+    return this->numElements;
+};
+
+size_t CuckooFilter::getBucketCount() const {
+    return this->numBuckets;
+};
+
+size_t CuckooFilter::getFingerprintBits() const {
+    return this->fingerprintBits;
+};
+
+double CuckooFilter::getLoadFactor() const {
+    return static_cast<double>(this->numElements) / (this->numBuckets * SLOTS_PER_BUCKET);
+};
+
+size_t CuckooFilter::getMemoryBytes() const {
+    return this->bits.size() * sizeof(uint64_t);
+};
+
+// Each of the 2 * 4 compared slots is occupied with probability 'load' and then
+// matches a random fingerprint with probability 1 / (2^f - 1)
+double CuckooFilter::estimatedFalsePositiveRate() const {
+    double matchOne = 1.0 / ((1U << this->fingerprintBits) - 1);
+    return 1 - std::pow(1 - matchOne, 2.0 * SLOTS_PER_BUCKET * this->getLoadFactor());
+};
+
+double CuckooFilter::getTargetFalsePositiveRate() const {
+    return this->targetFalsePositiveRate;
+};
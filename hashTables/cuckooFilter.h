@@ -0,0 +1,99 @@
+#pragma once
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint32_t, uint64_t
+#include <vector>
+#include "hashFunctions.h"
+
+// Cuckoo filter of ints (Fan et al., "Cuckoo Filter: Practically Better Than Bloom").
+//
+// Each value is reduced to a short fingerprint stored in one of two candidate
+// buckets of four slots. The second bucket is the first one XOR a hash of the
+// fingerprint, so a fingerprint can be moved between its buckets without the
+// original value, which is what makes deletion possible. Fingerprints are
+// 4 to 16 bits, chosen from the target false positive rate, and buckets are
+// packed back to back in a bit array. A lookup compares all four fingerprints
+// of a bucket at once with SWAR (SIMD within a register) arithmetic.
+//
+// The filter does not grow: when an insert cannot find room after MAX_KICKS
+// displacements, the last displaced fingerprint is kept aside and later inserts
+// fail until a remove makes room.
+class CuckooFilter {
+private:
+    static const size_t SLOTS_PER_BUCKET = 4;
+    static const size_t MAX_KICKS = 500;
+    const double MAX_LOAD_FACTOR = 0.95;   // Load reachable with 4-slot buckets; used for sizing
+
+    std::vector<uint64_t> bits;   // Buckets of 4 * fingerprintBits bits, plus one padding word
+    size_t numBuckets;            // Always a power of two
+    size_t fingerprintBits;
+    uint64_t lowBits;             // Lowest bit of each of the four fingerprint fields
+    uint64_t highBits;            // Highest bit of each field
+    size_t numElements;
+    double targetFalsePositiveRate;
+
+    // Fingerprint that did not fit after the last failed displacement chain
+    bool hasVictim;
+    uint32_t victimFingerprint;
+    size_t victimBucket;
+
+    uint64_t randomState;         // xorshift state for picking slots to evict
+
+    // Hash function (IntHash, mixed twice): the low bits select the first bucket, the high 32 bits the fingerprint
+    static uint64_t hashFunction(const int& value);
+
+    // Fingerprint of a hash, never 0 (0 marks an empty slot)
+    uint32_t fingerprintOf(uint64_t hash) const;
+
+    // The other candidate bucket of 'fingerprint', which is stored in 'bucket'
+    size_t alternateBucket(size_t bucket, uint32_t fingerprint) const;
+
+    // The four packed fingerprints of a bucket, slot 0 in the lowest bits
+    uint64_t readBucket(size_t bucket) const;
+
+    void writeBucket(size_t bucket, uint64_t contents);
+
+    // Whether any of the four fingerprints in 'contents' equals 'fingerprint'
+    bool bucketHas(uint64_t contents, uint32_t fingerprint) const;
+
+    // Stores the fingerprint in a free slot of the bucket; false if the bucket is full
+    bool insertIntoBucket(size_t bucket, uint32_t fingerprint);
+
+    // Clears one slot holding the fingerprint; false if there is none
+    bool removeFromBucket(size_t bucket, uint32_t fingerprint);
+
+    uint64_t nextRandom();
+
+public:
+    // Constructor: Sizes the filter for 'capacity' values at the given false positive
+    // rate. Throws std::invalid_argument unless 0 < rate < 1.
+    explicit CuckooFilter(size_t capacity, double falsePositiveRate = 0.01);
+
+    // insert: Adds the value; returns false if the filter is full. The same value may
+    // be inserted more than once (up to 8 times, two full buckets).
+    bool insert(const int& value);
+
+    // mightContain: false means the value is not in the filter; true means it probably is
+    bool mightContain(const int& value) const;
+
+    // remove: Removes one copy of the value; returns false if its fingerprint is absent.
+    // Only remove values that were inserted, or another value's fingerprint may go.
+    bool remove(const int& value);
+
+    // clear: Removes every fingerprint
+    void clear();
+
+    size_t getSize() const;
+
+    size_t getBucketCount() const;
+
+    size_t getFingerprintBits() const;
+
+    double getLoadFactor() const;
+
+    size_t getMemoryBytes() const;
+
+    // estimatedFalsePositiveRate: Expected rate at the current load (about 8 * load / 2^fingerprintBits)
+    double estimatedFalsePositiveRate() const;
+
+    double getTargetFalsePositiveRate() const;
+};
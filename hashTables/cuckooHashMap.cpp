@@ -0,0 +1,324 @@
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint8_t, uint64_t
+#include <stdexcept>
+#include <string>
+#include <utility>   // For std::pair, std::swap, std::move
+#include <vector>
+#include <iostream>
+#include "cuckooHashMap.h"
+
+template class CuckooHashMap<int, std::string>;
+
+template<typename KeyType, typename ValueType, typename Hasher>
+const size_t CuckooHashMap<KeyType, ValueType, Hasher>::SLOTS_PER_BUCKET;
+
+template<typename KeyType, typename ValueType, typename Hasher>
+const size_t CuckooHashMap<KeyType, ValueType, Hasher>::MAX_KICKS;
+
+template<typename KeyType, typename ValueType, typename Hasher>
+const size_t CuckooHashMap<KeyType, ValueType, Hasher>::STASH_SIZE;
+
+// An empty bucket.
+template<typename KeyType, typename ValueType, typename Hasher>
+CuckooHashMap<KeyType, ValueType, Hasher>::Bucket::Bucket() : tags(), keys(), values() { }
+
+// Tag of a key: the top byte of its hash, never 0 (0 marks an empty slot).
+template<typename KeyType, typename ValueType, typename Hasher>
+uint8_t CuckooHashMap<KeyType, ValueType, Hasher>::tagOf(uint64_t hash) {
+    uint8_t tag = static_cast<uint8_t>(hash >> 56);
+    return tag == 0 ? 1 : tag;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t CuckooHashMap<KeyType, ValueType, Hasher>::primaryBucket(uint64_t hash) const {
+    return static_cast<size_t>(hash) & (this->numBuckets - 1);
+}
+
+// Remixing the hash gives a second, independent hash function without hashing the key again.
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t CuckooHashMap<KeyType, ValueType, Hasher>::secondaryBucket(uint64_t hash) const {
+    return static_cast<size_t>(hashing::hashMix(hash ^ hashing::SECRET3, hashing::SECRET2)) & (this->numBuckets - 1);
+}
+
+// Looks in both buckets (the second one is prefetched while the first is scanned), then in the stash.
+template<typename KeyType, typename ValueType, typename Hasher>
+const ValueType* CuckooHashMap<KeyType, ValueType, Hasher>::findValue(const KeyType& key, uint64_t hash) const {
+    uint8_t tag = tagOf(hash);
+    const Bucket* candidates[2] = { &this->buckets[this->primaryBucket(hash)], &this->buckets[this->secondaryBucket(hash)] };
+    hashing::prefetch(candidates[1]);
+
+    for (const Bucket* bucket : candidates) {
+        for (size_t slot = 0; slot < SLOTS_PER_BUCKET; slot++) {
+            if (bucket->tags[slot] == tag && bucket->keys[slot] == key) {
+                return &bucket->values[slot];
+            }
+        }
+    }
+    for (const auto& entry : this->stash) {
+        if (entry.first == key) {
+            return &entry.second;
+        }
+    }
+    return nullptr;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+bool CuckooHashMap<KeyType, ValueType, Hasher>::placeInBucket(size_t bucketId, uint8_t tag,
+                                                              std::pair<KeyType, ValueType>& entry) {
+    Bucket& bucket = this->buckets[bucketId];
+    for (size_t slot = 0; slot < SLOTS_PER_BUCKET; slot++) {
+        if (bucket.tags[slot] == 0) {
+            bucket.tags[slot] = tag;
+            bucket.keys[slot] = std::move(entry.first);
+            bucket.values[slot] = std::move(entry.second);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Random-walk insertion: swap the carried entry with a random slot of one of its buckets,
+// then carry the evicted entry to its other bucket.
+template<typename KeyType, typename ValueType, typename Hasher>
+bool CuckooHashMap<KeyType, ValueType, Hasher>::placeNew(std::pair<KeyType, ValueType>&& entry, uint64_t hash) {
+    this->numElements++;
+    uint8_t tag = tagOf(hash);
+    size_t bucketId = this->primaryBucket(hash);
+    size_t alternate = this->secondaryBucket(hash);
+    if (this->placeInBucket(bucketId, tag, entry) || this->placeInBucket(alternate, tag, entry)) {
+        return true;
+    }
+
+    if (this->nextRandom() & 1) {
+        bucketId = alternate;
+    }
+    for (size_t kick = 0; kick < MAX_KICKS; kick++) {
+        Bucket& bucket = this->buckets[bucketId];
+        size_t slot = static_cast<size_t>(this->nextRandom() % SLOTS_PER_BUCKET);
+        std::swap(bucket.tags[slot], tag);
+        std::swap(bucket.keys[slot], entry.first);
+        std::swap(bucket.values[slot], entry.second);
+
+        // The evicted entry's other bucket is whichever of its two buckets this is not
+        uint64_t evictedHash = this->hasher(entry.first);
+        size_t first = this->primaryBucket(evictedHash);
+        bucketId = first != bucketId ? first : this->secondaryBucket(evictedHash);
+        if (this->placeInBucket(bucketId, tag, entry)) {
+            return true;
+        }
+    }
+    this->stash.push_back(std::move(entry));
+    return this->stash.size() <= STASH_SIZE;
+}
+
+// Collects every entry and places it again. If the stash overflows part way through
+// (and the load is high enough for growing to help), the remaining entries join the
+// stash and the rebuild restarts at twice the size.
+template<typename KeyType, typename ValueType, typename Hasher>
+void CuckooHashMap<KeyType, ValueType, Hasher>::rehash(size_t newBuckets) {
+    std::vector<std::pair<KeyType, ValueType>> entries;
+    entries.reserve(this->numElements);
+    for (auto& bucket : this->buckets) {
+        for (size_t slot = 0; slot < SLOTS_PER_BUCKET; slot++) {
+            if (bucket.tags[slot] != 0) {
+                entries.emplace_back(std::move(bucket.keys[slot]), std::move(bucket.values[slot]));
+            }
+        }
+    }
+    for (auto& entry : this->stash) {
+        entries.push_back(std::move(entry));
+    }
+
+    this->buckets.assign(newBuckets, Bucket());
+    this->numBuckets = newBuckets;
+    this->numElements = 0;
+    this->stash.clear();
+
+    for (size_t i = 0; i < entries.size(); i++) {
+        uint64_t hash = this->hasher(entries[i].first);
+        if (!this->placeNew(std::move(entries[i]), hash) && this->stashOverflowGrows(entries.size())) {
+            for (size_t j = i + 1; j < entries.size(); j++) {
+                this->stash.push_back(std::move(entries[j]));
+            }
+            this->numElements += entries.size() - i - 1;
+            this->rehash(newBuckets * 2);
+            return;
+        }
+    }
+}
+
+// A stash that overflows at a low load is caused by many keys sharing a hash, not by a
+// full table, and growing would not help: those entries stay in the (larger) stash.
+template<typename KeyType, typename ValueType, typename Hasher>
+bool CuckooHashMap<KeyType, ValueType, Hasher>::stashOverflowGrows(size_t entries) const {
+    return static_cast<double>(entries) >= this->numBuckets * SLOTS_PER_BUCKET * MIN_GROW_LOAD_FACTOR;
+}
+
+// Moves stashed entries back into a bucket with a free slot, without evicting anything.
+template<typename KeyType, typename ValueType, typename Hasher>
+void CuckooHashMap<KeyType, ValueType, Hasher>::drainStash() {
+    for (size_t i = 0; i < this->stash.size(); ) {
+        uint64_t hash = this->hasher(this->stash[i].first);
+        uint8_t tag = tagOf(hash);
+        if (this->placeInBucket(this->primaryBucket(hash), tag, this->stash[i])
+            || this->placeInBucket(this->secondaryBucket(hash), tag, this->stash[i])) {
+            this->stash.erase(this->stash.begin() + i);
+        } else {
+            i++;
+        }
+    }
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+uint64_t CuckooHashMap<KeyType, ValueType, Hasher>::nextRandom() {
+    this->randomState ^= this->randomState << 13;
+    this->randomState ^= this->randomState >> 7;
+    this->randomState ^= this->randomState << 17;
+    return this->randomState;
+}
+
+// Constructor rounds the requested number of slots up to a power of two.
+template<typename KeyType, typename ValueType, typename Hasher>
+CuckooHashMap<KeyType, ValueType, Hasher>::CuckooHashMap(size_t size, const Hasher& hasher)
+    : numBuckets(0), numElements(0), hasher(hasher), randomState(0x9E3779B97F4A7C15ULL) {
+    this->numBuckets = MIN_BUCKETS;
+    while (this->numBuckets * SLOTS_PER_BUCKET < size) {
+        this->numBuckets *= 2;
+    }
+    this->buckets.resize(this->numBuckets);
+}
+
+// Returns the current load factor (elements/slots).
+template<typename KeyType, typename ValueType, typename Hasher>
+double CuckooHashMap<KeyType, ValueType, Hasher>::getLoadFactor() const {
+    return static_cast<double>(this->numElements) / (this->numBuckets * SLOTS_PER_BUCKET);
+}
+
+// Inserts a new key-value pair; doubles the table above the maximum load factor or
+// when the stash overflows.
+template<typename KeyType, typename ValueType, typename Hasher>
+void CuckooHashMap<KeyType, ValueType, Hasher>::insert(const KeyType& key, const ValueType& value) {
+    uint64_t hash = this->hasher(key);
+    if (this->findValue(key, hash) != nullptr) {
+        return;
+    }
+    if (static_cast<double>(this->numElements + 1) > this->numBuckets * SLOTS_PER_BUCKET * MAX_LOAD_FACTOR) {
+        this->rehash(this->numBuckets * 2);
+    }
+    if (!this->placeNew(std::make_pair(key, value), hash) && this->stashOverflowGrows(this->numElements)) {
+        this->rehash(this->numBuckets * 2);
+    }
+}
+
+// Removes the key from its bucket or the stash; the freed slot may take back a stashed entry.
+template<typename KeyType, typename ValueType, typename Hasher>
+void CuckooHashMap<KeyType, ValueType, Hasher>::remove(const KeyType& key) {
+    uint64_t hash = this->hasher(key);
+    uint8_t tag = tagOf(hash);
+    size_t candidates[2] = { this->primaryBucket(hash), this->secondaryBucket(hash) };
+    bool removed = false;
+
+    for (size_t bucketId : candidates) {
+        Bucket& bucket = this->buckets[bucketId];
+        for (size_t slot = 0; slot < SLOTS_PER_BUCKET && !removed; slot++) {
+            if (bucket.tags[slot] == tag && bucket.keys[slot] == key) {
+                bucket.tags[slot] = 0;
+                bucket.keys[slot] = KeyType();       // Releases memory held by the key and value
+                bucket.values[slot] = ValueType();
+                removed = true;
+            }
+        }
+    }
+    for (size_t i = 0; i < this->stash.size() && !removed; i++) {
+        if (this->stash[i].first == key) {
+            this->stash.erase(this->stash.begin() + i);
+            removed = true;
+        }
+    }
+    if (!removed) {
+        return;
+    }
+    this->numElements--;
+    this->drainStash();
+
+    if (getLoadFactor() < MIN_LOAD_FACTOR && this->numBuckets > MIN_BUCKETS) {
+        this->rehash(this->numBuckets / 2);
+    }
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+ValueType* CuckooHashMap<KeyType, ValueType, Hasher>::find(const KeyType& key) {
+    return const_cast<ValueType*>(this->findValue(key, this->hasher(key)));
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+const ValueType* CuckooHashMap<KeyType, ValueType, Hasher>::find(const KeyType& key) const {
+    return this->findValue(key, this->hasher(key));
+}
+
+// Returns a reference to the value for the given key; throws if not found.
+template<typename KeyType, typename ValueType, typename Hasher>
+ValueType& CuckooHashMap<KeyType, ValueType, Hasher>::get(const KeyType& key) {
+    ValueType* value = this->find(key);
+    if (value == nullptr) {
+        throw std::out_of_range("Key not found");
+    }
+    return *value;
+}
+
+// Checks if the key exists in the map.
+template<typename KeyType, typename ValueType, typename Hasher>
+bool CuckooHashMap<KeyType, ValueType, Hasher>::contains(const KeyType& key) const {
+    return this->findValue(key, this->hasher(key)) != nullptr;
+}
+
+// Clears all elements, keeping the current number of buckets.
+template<typename KeyType, typename ValueType, typename Hasher>
+void CuckooHashMap<KeyType, ValueType, Hasher>::clear() {
+    this->buckets.assign(this->numBuckets, Bucket());
+    this->stash.clear();
+    this->numElements = 0;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t CuckooHashMap<KeyType, ValueType, Hasher>::getSize() const {
+    return this->numElements;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t CuckooHashMap<KeyType, ValueType, Hasher>::getTableSize() const {
+    return this->numBuckets * SLOTS_PER_BUCKET;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t CuckooHashMap<KeyType, ValueType, Hasher>::getStashSize() const {
+    return this->stash.size();
+}
+
+// Prints the non-empty buckets and the stash for debugging.
+template<typename KeyType, typename ValueType, typename Hasher>
+void CuckooHashMap<KeyType, ValueType, Hasher>::print() const {
+    for (size_t i = 0; i < this->numBuckets; i++) {
+        const Bucket& bucket = this->buckets[i];
+        bool empty = true;
+        for (size_t slot = 0; slot < SLOTS_PER_BUCKET; slot++) {
+            if (bucket.tags[slot] != 0) {
+                if (empty) {
+                    std::cout << "Bucket " << i << ": ";
+                    empty = false;
+                }
+                std::cout << "(" << bucket.keys[slot] << ", " << bucket.values[slot] << ") ";
+            }
+        }
+        if (!empty) {
+            std::cout << std::endl;
+        }
+    }
+    if (!this->stash.empty()) {
+        std::cout << "Stash: ";
+        for (const auto& entry : this->stash) {
+            std::cout << "(" << entry.first << ", " << entry.second << ") ";
+        }
+        std::cout << std::endl;
+    }
+}
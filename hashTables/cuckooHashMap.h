@@ -0,0 +1,114 @@
+#pragma once
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint8_t, uint64_t
+#include <stdexcept>
+#include <utility>   // For std::pair
+#include <vector>
+#include <iostream>
+#include "hashFunctions.h"
+
+
+// Bucketized cuckoo hash map.
+// Every key has exactly two candidate buckets of four slots, chosen by two hash
+// functions, and is always stored in one of them or in a small stash. A lookup
+// therefore inspects at most 8 slots plus the stash, whatever the load: the worst
+// case is constant, not just the average. Insertion pays instead: when both buckets
+// are full it evicts a random entry to that entry's other bucket, and so on. A chain
+// that runs too long leaves its last entry in the stash; a full stash grows the table.
+// (A hasher that maps many keys to one hash defeats any table size: those keys then
+// overflow into the stash, and lookups of them degrade to a scan of it.)
+template<typename KeyType, typename ValueType, typename Hasher = DefaultHash<KeyType>>
+class CuckooHashMap {
+private:
+    static const size_t SLOTS_PER_BUCKET = 4;
+    static const size_t MAX_KICKS = 256;     // Evictions tried before an entry goes to the stash
+    static const size_t STASH_SIZE = 4;
+
+    // Four slots with a one-byte tag each (0 marks an empty slot); keys are only
+    // compared where the tag, taken from the top of the hash, matches
+    struct Bucket {
+        uint8_t tags[SLOTS_PER_BUCKET];
+        KeyType keys[SLOTS_PER_BUCKET];
+        ValueType values[SLOTS_PER_BUCKET];
+
+        Bucket();
+    };
+
+    std::vector<Bucket> buckets;
+    size_t numBuckets;     // Always a power of two
+    size_t numElements;    // Entries in the buckets and in the stash
+    std::vector<std::pair<KeyType, ValueType>> stash;
+    Hasher hasher;
+    uint64_t randomState;  // xorshift state for picking eviction victims
+
+    const double MAX_LOAD_FACTOR = 0.9;
+    const double MIN_LOAD_FACTOR = 0.2;
+    const double MIN_GROW_LOAD_FACTOR = 0.5;   // Below this load a stash overflow does not grow the table
+    const size_t MIN_BUCKETS = 2;
+
+    static uint8_t tagOf(uint64_t hash);
+
+    // First candidate bucket: the low bits of the key's hash
+    size_t primaryBucket(uint64_t hash) const;
+
+    // Second candidate bucket: the low bits of a second hash, derived by remixing the first
+    size_t secondaryBucket(uint64_t hash) const;
+
+    // Pointer to the value of 'key' in its two buckets or the stash, or nullptr
+    const ValueType* findValue(const KeyType& key, uint64_t hash) const;
+
+    // Stores the entry in a free slot of the bucket; false if the bucket is full
+    bool placeInBucket(size_t bucket, uint8_t tag, std::pair<KeyType, ValueType>& entry);
+
+    // Stores an entry whose key is absent, evicting along a random cuckoo path if both
+    // buckets are full. Returns false if the stash now holds more than STASH_SIZE
+    // entries; the caller then grows the table (see stashOverflowGrows).
+    bool placeNew(std::pair<KeyType, ValueType>&& entry, uint64_t hash);
+
+    // Moves every entry into a table of 'newBuckets' buckets, doubling it again if
+    // the stash overflows on the way
+    void rehash(size_t newBuckets);
+
+    // Whether a stash overflow with 'entries' entries should double the table
+    bool stashOverflowGrows(size_t entries) const;
+
+    // Tries to move stashed entries back into their buckets (after a remove)
+    void drainStash();
+
+    uint64_t nextRandom();
+
+public:
+    // Constructor: the requested number of slots is rounded up to a power of two
+    explicit CuckooHashMap(size_t size = 128, const Hasher& hasher = Hasher());
+
+    ~CuckooHashMap() = default;
+
+    double getLoadFactor() const;
+
+    // insert: Adds the pair if the key is not present yet (same semantics as HashMap)
+    void insert(const KeyType& key, const ValueType& value);
+
+    // remove: Removes the key if present
+    void remove(const KeyType& key);
+
+    // find: Returns a pointer to the value of the key, or nullptr if it is absent
+    ValueType* find(const KeyType& key);
+
+    const ValueType* find(const KeyType& key) const;
+
+    // get: Returns a reference to the value of the key; throws if not found
+    ValueType& get(const KeyType& key);
+
+    bool contains(const KeyType& key) const;
+
+    void clear();
+
+    size_t getSize() const;
+
+    // getTableSize: Number of slots (4 per bucket), not counting the stash
+    size_t getTableSize() const;
+
+    size_t getStashSize() const;
+
+    void print() const;
+};
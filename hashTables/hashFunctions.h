@@ -0,0 +1,171 @@
+#pragma once
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint32_t, uint64_t
+#include <cstring>   // For std::memcpy
+#include <functional>
+#include <string>
+#include <type_traits>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+// Hash functions shared by the hash tables in this folder.
+// A hasher is a function object returning a 64-bit hash whose every bit depends
+// on every bit of the key, so tables can take the low bits (mask) or the high
+// bits (shift) of it without clustering on patterned keys.
+
+namespace hashing {
+
+const uint64_t SECRET0 = 0xA0761D6478BD642FULL;
+const uint64_t SECRET1 = 0xE7037ED1A0B428DBULL;
+const uint64_t SECRET2 = 0x8EBC6AF09C88C6E3ULL;
+const uint64_t SECRET3 = 0x589965CC75374CC3ULL;
+
+// Multiplies a by b to 128 bits and folds the halves together
+inline uint64_t hashMix(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    __uint128_t product = static_cast<__uint128_t>(a) * b;
+    return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#else
+    uint64_t aLow = a & 0xFFFFFFFFULL, aHigh = a >> 32;
+    uint64_t bLow = b & 0xFFFFFFFFULL, bHigh = b >> 32;
+    uint64_t low = aLow * bLow, middle1 = aLow * bHigh, middle2 = aHigh * bLow, high = aHigh * bHigh;
+    uint64_t carry = ((low >> 32) + (middle1 & 0xFFFFFFFFULL) + (middle2 & 0xFFFFFFFFULL)) >> 32;
+    uint64_t productLow = low + (middle1 << 32) + (middle2 << 32);
+    uint64_t productHigh = high + (middle1 >> 32) + (middle2 >> 32) + carry;
+    return productLow ^ productHigh;
+#endif
+}
+
+inline uint64_t read64(const unsigned char* bytes) {
+    uint64_t value;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+inline uint64_t read32(const unsigned char* bytes) {
+    uint32_t value;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+// wyhash-style hash of a byte range: 48 bytes per round in three independent
+// lanes for long inputs, overlapping reads for the tail, no per-byte loop.
+inline uint64_t hashBytes(const void* data, size_t length, uint64_t seed = 0) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    seed ^= hashMix(seed ^ SECRET0, SECRET1);
+    uint64_t a, b;
+
+    if (length <= 16) {
+        if (length >= 4) {
+            size_t offset = (length >> 3) << 2;   // 0 for 4..7 bytes, 4 for 8..15 bytes, 8 for 16 bytes
+            a = (read32(bytes) << 32) | read32(bytes + offset);
+            b = (read32(bytes + length - 4) << 32) | read32(bytes + length - 4 - offset);
+        } else if (length > 0) {
+            a = (static_cast<uint64_t>(bytes[0]) << 16) | (static_cast<uint64_t>(bytes[length >> 1]) << 8)
+                | bytes[length - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t remaining = length;
+        if (remaining > 48) {
+            uint64_t lane1 = seed, lane2 = seed;
+            do {
+                seed = hashMix(read64(bytes) ^ SECRET1, read64(bytes + 8) ^ seed);
+                lane1 = hashMix(read64(bytes + 16) ^ SECRET2, read64(bytes + 24) ^ lane1);
+                lane2 = hashMix(read64(bytes + 32) ^ SECRET3, read64(bytes + 40) ^ lane2);
+                bytes += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= lane1 ^ lane2;
+        }
+        while (remaining > 16) {
+            seed = hashMix(read64(bytes) ^ SECRET1, read64(bytes + 8) ^ seed);
+            bytes += 16;
+            remaining -= 16;
+        }
+        a = read64(bytes + remaining - 16);
+        b = read64(bytes + remaining - 8);
+    }
+    return hashMix(SECRET1 ^ length, hashMix(a ^ SECRET1, b ^ seed));
+}
+
+// Asks the CPU to start loading the cache line holding 'address' for a read.
+// Batched lookups use it to overlap the cache misses of many keys.
+inline void prefetch(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, 3);
+#else
+    (void)address;
+#endif
+}
+
+} // namespace hashing
+
+// IntHash: multiply-shift mixer for integers (and enums). One 128-bit multiply
+// spreads sequential and strided keys over all 64 bits.
+struct IntHash {
+    template<typename IntType>
+    uint64_t operator()(IntType key) const {
+        return hashing::hashMix(static_cast<uint64_t>(key) ^ hashing::SECRET0, hashing::SECRET1);
+    }
+};
+
+// BytesHash: hashes the bytes of a string. std::string, C strings and
+// std::string_view with the same characters hash to the same value, so tables
+// with std::string keys can be searched with a std::string_view (LookupType).
+struct BytesHash {
+#if __cplusplus >= 201703L
+    using LookupType = std::string_view;
+#endif
+
+    uint64_t operator()(const std::string& key) const {
+        return hashing::hashBytes(key.data(), key.size());
+    }
+
+    uint64_t operator()(const char* key) const {
+        return hashing::hashBytes(key, std::strlen(key));
+    }
+
+#if __cplusplus >= 201703L
+    uint64_t operator()(std::string_view key) const {
+        return hashing::hashBytes(key.data(), key.size());
+    }
+#endif
+};
+
+// DefaultHash: picks IntHash for integral and enum keys, BytesHash for strings,
+// and finalises std::hash through hashMix for everything else (std::hash of an
+// integer is often the identity, which would defeat masking).
+template<typename KeyType, typename Enable = void>
+struct DefaultHash {
+    uint64_t operator()(const KeyType& key) const {
+        return hashing::hashMix(static_cast<uint64_t>(std::hash<KeyType>()(key)) ^ hashing::SECRET2, hashing::SECRET1);
+    }
+};
+
+template<typename KeyType>
+struct DefaultHash<KeyType, typename std::enable_if<std::is_integral<KeyType>::value || std::is_enum<KeyType>::value>::type>
+    : IntHash { };
+
+template<>
+struct DefaultHash<std::string> : BytesHash { };
+
+// HasherLookupType: the argument type of lookups. It is Hasher::LookupType when the
+// hasher declares one (and then must hash it like the key), KeyType otherwise.
+template<typename T>
+struct AlwaysVoid {
+    using type = void;
+};
+
+template<typename KeyType, typename Hasher, typename Enable = void>
+struct HasherLookupType {
+    using type = KeyType;
+};
+
+template<typename KeyType, typename Hasher>
+struct HasherLookupType<KeyType, Hasher, typename AlwaysVoid<typename Hasher::LookupType>::type> {
+    using type = typename Hasher::LookupType;
+};
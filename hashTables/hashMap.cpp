@@ -1,156 +1,600 @@
 #include <utility>   // For std::pair
 #include <stdexcept>
+#include <functional>
 #include <vector>
 #include <list>
 #include <iostream>
+#include <string>
+#include <cstdint>   // For uint64_t
+#include <cmath>     // For std::ceil, std::floor
+#include <algorithm> // For std::stable_sort
 #include "hashMap.h"
+#include "parallelRange.h"
+#include "hashSnapshot.h"
 
 template class HashMap<int, std::string>;
+template class HashMap<std::string, int>;
+template class HashMap<std::string, std::string>;
+template class HashMap<int, uint32_t>;           // ConcurrentCache index
+template class HashMap<std::string, uint32_t>;
 
-// Computes the bucket index for a given key.
-template<typename KeyType, typename ValueType>
-size_t HashMap< KeyType, ValueType>::hashFunction(const KeyType& key) const {
-    return static_cast<size_t>(key) % this->tableSize;
+// Rounds a requested table size up to the next power of two (at least 'minimum').
+static size_t roundUpToPowerOfTwo(size_t size, size_t minimum) {
+    size_t power = minimum;
+    while (power < size) {
+        power *= 2;
+    }
+    return power;
 }
 
-// Doubles the table size and rehashes all elements.
-template<typename KeyType, typename ValueType>
-void HashMap< KeyType, ValueType>::resizeUp() {
-    size_t newSize = this->tableSize * 2;
-    std::vector<std::list<std::pair<KeyType, ValueType>>> newTable(newSize);
+// Removes the pair holding 'key' from the bucket; returns false if it is not there.
+template<typename Bucket, typename LookupKey>
+static bool eraseKey(Bucket& bucket, const LookupKey& key) {
+    for (auto it = bucket.begin(); it != bucket.end(); it++) {
+        if (it->first == key) {
+            bucket.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
 
-    // Rehash each element into the new table.
-    for (const auto& bucket : this->table) {
-        for (const auto& pair : bucket) {
-            size_t newBucketId = static_cast<size_t>(pair.first) % newSize;
-            newTable[newBucketId].push_back(pair);
+// Computes the bucket index for a hash by masking its low bits.
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t HashMap< KeyType, ValueType, Hasher>::bucketIndex(uint64_t hash, size_t size) {
+    return static_cast<size_t>(hash) & (size - 1);
+}
+
+// Looks in the current table, then in the old bucket if it has not been migrated yet.
+template<typename KeyType, typename ValueType, typename Hasher>
+const std::pair<KeyType, ValueType>* HashMap< KeyType, ValueType, Hasher>::findPair(const LookupKey& key, uint64_t hash) const {
+    for (const auto& pair : this->table[bucketIndex(hash, this->tableSize)]) {
+        if (pair.first == key)
+            return &pair;
+    }
+    if (this->isRehashing()) {
+        size_t oldBucketId = bucketIndex(hash, this->oldTable.size());
+        if (oldBucketId >= this->rehashIndex) {
+            for (const auto& pair : this->oldTable[oldBucketId]) {
+                if (pair.first == key)
+                    return &pair;
+            }
         }
     }
-    this->table = std::move(newTable);
+    return nullptr;
+}
+
+// Batched lookup with prefetching. Buckets of the old table are not prefetched; during a
+// resize findPair still checks them.
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::findBatch(const LookupKey* keys, size_t count,
+                                                     const std::pair<KeyType, ValueType>** pairs) const {
+    const size_t DISTANCE = BATCH_WIDTH / 2;
+    uint64_t hashes[BATCH_WIDTH];
+
+    // Key i is searched DISTANCE steps after its first node was prefetched, which is DISTANCE
+    // steps after its bucket was prefetched. Stages run oldest first, so a hash slot is
+    // reused only after its key has been searched.
+    for (size_t step = 0; step < count + 2 * DISTANCE; step++) {
+        if (step >= 2 * DISTANCE) {
+            size_t i = step - 2 * DISTANCE;
+            pairs[i] = this->findPair(keys[i], hashes[i % BATCH_WIDTH]);
+        }
+        if (step >= DISTANCE && step - DISTANCE < count) {
+            const Bucket& bucket = this->table[bucketIndex(hashes[(step - DISTANCE) % BATCH_WIDTH], this->tableSize)];
+            if (!bucket.empty()) {
+                hashing::prefetch(&bucket.front());
+            }
+        }
+        if (step < count) {
+            hashes[step % BATCH_WIDTH] = this->hasher(keys[step]);
+            hashing::prefetch(&this->table[bucketIndex(hashes[step % BATCH_WIDTH], this->tableSize)]);
+        }
+    }
+}
+
+// Smallest power-of-two table size that keeps 'count' elements at or below maxLoadFactor.
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t HashMap< KeyType, ValueType, Hasher>::bucketsFor(size_t count) const {
+    size_t needed = static_cast<size_t>(std::ceil(count / this->maxLoadFactor));
+    return roundUpToPowerOfTwo(needed, MIN_TABLE_SIZE);
+}
+
+// Allocates a table of 'newSize' buckets and keeps the current one as the old table.
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::resize(size_t newSize) {
+    // A resize requested while another one is running finishes the first one
+    this->rehashStep(this->oldTable.size());
+
+    this->resizeCounters.countResize(this->tableSize, newSize);
+    {
+        RehashTimer timer(this->resizeCounters);
+        this->oldTable = std::move(this->table);
+        this->table = std::vector<Bucket>(newSize);
+    }
     this->tableSize = newSize;
+    this->rehashIndex = 0;
+    this->rehashStepSize = this->rehashStepFor(this->oldTable.size());
+
+    if (!this->incrementalResize) {
+        this->rehashStep(this->oldTable.size());
+    }
+}
+
+// Splices the nodes of up to 'buckets' old buckets into the current table (no allocation).
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::rehashStep(size_t buckets) {
+    if (!this->isRehashing()) {
+        return;
+    }
+    RehashTimer timer(this->resizeCounters);
+    while (buckets > 0 && this->rehashIndex < this->oldTable.size()) {
+        Bucket& bucket = this->oldTable[this->rehashIndex];
+        while (!bucket.empty()) {
+            Bucket& target = this->table[bucketIndex(this->hasher(bucket.front().first), this->tableSize)];
+            target.splice(target.end(), bucket, bucket.begin());
+        }
+        this->rehashIndex++;
+        buckets--;
+    }
+    if (this->isRehashing() && this->rehashIndex == this->oldTable.size()) {
+        std::vector<Bucket>().swap(this->oldTable);
+        this->rehashIndex = 0;
+    }
+}
+
+// An insert grows the table when it finds more than maxLoadFactor * tableSize elements,
+// a remove shrinks it when fewer than minLoadFactor * tableSize remain, and both migrate
+// before they check. Each insert or remove moves the count one step towards at most one
+// of the limits, so the nearer limit bounds the operations left for the migration.
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t HashMap< KeyType, ValueType, Hasher>::rehashStepFor(size_t oldBuckets) const {
+    double growAt = std::floor(this->maxLoadFactor * this->tableSize) + 1;     // Elements an insert grows at
+    size_t operations = growAt > this->numElements ? static_cast<size_t>(growAt) - this->numElements + 1 : 1;
+    double shrinkAt = std::ceil(this->minLoadFactor * this->tableSize) - 1;    // Elements a remove shrinks at
+    if (this->autoShrink && shrinkAt >= 0) {
+        size_t removes = shrinkAt < this->numElements ? this->numElements - static_cast<size_t>(shrinkAt) : 1;
+        operations = removes < operations ? removes : operations;
+    }
+    operations = operations > 1 ? operations - 1 : 1;    // One operation of slack for rounding in getLoadFactor
+    size_t step = (oldBuckets + operations - 1) / operations;
+    return step < REHASH_STEP ? REHASH_STEP : step;
+}
+
+// Doubles the table size and rehashes all elements.
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::resizeUp() {
+    this->resize(this->tableSize * 2);
 }
 
 // Halves the table size (not below MIN_TABLE_SIZE) and rehashes all elements.
-template<typename KeyType, typename ValueType>
-void HashMap< KeyType, ValueType>::resizeDown() {
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::resizeDown() {
     size_t newSize = this->tableSize / 2;
     if (newSize < MIN_TABLE_SIZE) {
         newSize = MIN_TABLE_SIZE;
     }
-    std::vector<std::list<std::pair<KeyType, ValueType>>> newTable(newSize);
-
-    // Rehash each element into the new table.
-    for (const auto& bucket : this->table) {
-        for (const auto& pair : bucket) {
-            size_t newBucketId = static_cast<size_t>(pair.first) % newSize;
-            newTable[newBucketId].push_back(pair);
-        }
+    if (newSize != this->tableSize) {
+        this->resize(newSize);
     }
-    this->table = std::move(newTable);
-    this->tableSize = newSize;
 }
 
-// Constructor initializes the hash map with a given table size.
-template<typename KeyType, typename ValueType>
-HashMap< KeyType, ValueType>::HashMap(size_t size) : table(size), tableSize(size), numElements(0) { }
+// Constructor initializes the hash map with a power-of-two table size.
+template<typename KeyType, typename ValueType, typename Hasher>
+HashMap< KeyType, ValueType, Hasher>::HashMap(size_t size, const Hasher& hasher)
+    : numElements(0), hasher(hasher), rehashIndex(0), rehashStepSize(0), incrementalResize(false),
+      maxLoadFactor(0.7), minLoadFactor(0.3), autoShrink(true) {
+    this->tableSize = roundUpToPowerOfTwo(size, MIN_TABLE_SIZE);
+    this->table.resize(this->tableSize);
+}
 
 // Destructor clears all buckets and resets the table.
-template<typename KeyType, typename ValueType>
-HashMap< KeyType, ValueType>::~HashMap() {
+template<typename KeyType, typename ValueType, typename Hasher>
+HashMap< KeyType, ValueType, Hasher>::~HashMap() {
     for (auto& bucket : this->table) {
         bucket.clear();
     }
     this->table.clear();
+    this->oldTable.clear();
     this->numElements = 0;
 }
 
 // Returns the current load factor (elements/table size).
-template<typename KeyType, typename ValueType>
-double HashMap< KeyType, ValueType>::getLoadFactor() const {
+template<typename KeyType, typename ValueType, typename Hasher>
+double HashMap< KeyType, ValueType, Hasher>::getLoadFactor() const {
     return static_cast<double>(this->numElements) / this->tableSize;
 }
 
-// Inserts a new key-value pair; resizes table if load factor exceeds maximum.
-template<typename KeyType, typename ValueType>
-void HashMap< KeyType, ValueType>::insert(const KeyType& key, const ValueType& value) {
-    if (contains(key)) return;
-
-    if (getLoadFactor() > MAX_LOAD_FACTOR) {
+// Appends a pair whose key is known to be absent. 'hash' is reused for the bucket
+// index, so a resize in between does not cost another hash of the key.
+template<typename KeyType, typename ValueType, typename Hasher>
+ValueType* HashMap< KeyType, ValueType, Hasher>::insertNew(const KeyType& key, const ValueType& value, uint64_t hash) {
+    this->rehashStep(this->rehashStepSize);
+    if (getLoadFactor() > this->maxLoadFactor) {
         resizeUp();
     }
-    size_t bucketId = hashFunction(key);
-    this->table[bucketId].push_back(std::make_pair(key, value));
+    Bucket& bucket = this->table[bucketIndex(hash, this->tableSize)];
+    bucket.push_back(std::make_pair(key, value));
     this->numElements++;
+    return &bucket.back().second;
 }
 
-// Removes the key-value pair associated with the given key.
-template<typename KeyType, typename ValueType>
-void HashMap< KeyType, ValueType>::remove(const KeyType& key) {
-    if (!contains(key)) return;
+// Inserts a new key-value pair; resizes table if load factor exceeds maximum.
+// The key is hashed once: the hash serves both the lookup and the placement.
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::insert(const KeyType& key, const ValueType& value) {
+    this->tryEmplace(key, value);
+}
 
-    size_t bucketId = hashFunction(key);
-    auto& bucket = this->table[bucketId];
-    for (auto it = bucket.begin(); it != bucket.end(); it++) {
-        if (it->first == key) {
-            bucket.erase(it);
-            this->numElements--;
-            break;
-        }
+// Inserts the pair if the key is absent and returns the key's value either way.
+template<typename KeyType, typename ValueType, typename Hasher>
+std::pair<ValueType*, bool> HashMap< KeyType, ValueType, Hasher>::tryEmplace(const KeyType& key, const ValueType& value) {
+    uint64_t hash = this->hasher(key);
+    const std::pair<KeyType, ValueType>* existing = this->findPair(key, hash);
+    if (existing != nullptr) {
+        return std::make_pair(const_cast<ValueType*>(&existing->second), false);
     }
-    if (getLoadFactor() < MIN_LOAD_FACTOR) {
+    return std::make_pair(this->insertNew(key, value, hash), true);
+}
+
+// Inserts the pair, or overwrites the value of an existing key.
+template<typename KeyType, typename ValueType, typename Hasher>
+std::pair<ValueType*, bool> HashMap< KeyType, ValueType, Hasher>::insertOrAssign(const KeyType& key, const ValueType& value) {
+    uint64_t hash = this->hasher(key);
+    const std::pair<KeyType, ValueType>* existing = this->findPair(key, hash);
+    if (existing != nullptr) {
+        ValueType* stored = const_cast<ValueType*>(&existing->second);
+        *stored = value;
+        return std::make_pair(stored, false);
+    }
+    return std::make_pair(this->insertNew(key, value, hash), true);
+}
+
+// Removes the key-value pair associated with the given key.
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::remove(const LookupKey& key) {
+    uint64_t hash = this->hasher(key);
+    bool erased = eraseKey(this->table[bucketIndex(hash, this->tableSize)], key);
+    if (!erased && this->isRehashing()) {
+        size_t oldBucketId = bucketIndex(hash, this->oldTable.size());
+        erased = oldBucketId >= this->rehashIndex && eraseKey(this->oldTable[oldBucketId], key);
+    }
+    if (!erased) return;
+    this->numElements--;
+
+    this->rehashStep(this->rehashStepSize);
+    if (this->autoShrink && getLoadFactor() < this->minLoadFactor) {
         resizeDown();
     }
 }
 
+// Returns a pointer to the value for the given key, or nullptr if it is absent.
+template<typename KeyType, typename ValueType, typename Hasher>
+ValueType* HashMap< KeyType, ValueType, Hasher>::find(const LookupKey& key) {
+    const std::pair<KeyType, ValueType>* pair = this->findPair(key, this->hasher(key));
+    return pair == nullptr ? nullptr : const_cast<ValueType*>(&pair->second);
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+const ValueType* HashMap< KeyType, ValueType, Hasher>::find(const LookupKey& key) const {
+    const std::pair<KeyType, ValueType>* pair = this->findPair(key, this->hasher(key));
+    return pair == nullptr ? nullptr : &pair->second;
+}
+
 // Returns a reference to the value for the given key; throws if not found.
-template<typename KeyType, typename ValueType>
-ValueType& HashMap< KeyType, ValueType>::get(const KeyType& key) {
-    size_t bucketId = hashFunction(key);
-    for (auto& pair : this->table[bucketId]) {
-        if (pair.first == key)
-            return pair.second;
+template<typename KeyType, typename ValueType, typename Hasher>
+ValueType& HashMap< KeyType, ValueType, Hasher>::get(const LookupKey& key) {
+    ValueType* value = this->find(key);
+    if (value == nullptr) {
+        throw std::out_of_range("Key not found");
     }
-    throw std::out_of_range("Key not found");
+    return *value;
 }
 
 // Checks if the key exists in the map.
-template<typename KeyType, typename ValueType>
-bool HashMap< KeyType, ValueType>::contains(const KeyType& key) const {
-    size_t bucketId = hashFunction(key);
+template<typename KeyType, typename ValueType, typename Hasher>
+bool HashMap< KeyType, ValueType, Hasher>::contains(const LookupKey& key) const {
+    return this->findPair(key, this->hasher(key)) != nullptr;
+}
 
-    for (const auto& pair : this->table[bucketId]) {
-        if (pair.first == key)
-            return true;
+// Looks up every key of the batch; missing keys get a nullptr value.
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t HashMap< KeyType, ValueType, Hasher>::getMany(const std::vector<LookupKey>& keys,
+                                                     std::vector<const ValueType*>& values) const {
+    std::vector<const std::pair<KeyType, ValueType>*> pairs(keys.size());
+    this->findBatch(keys.data(), keys.size(), pairs.data());
+
+    size_t found = 0;
+    values.resize(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        values[i] = pairs[i] == nullptr ? nullptr : &pairs[i]->second;
+        found += pairs[i] != nullptr;
     }
-    return false;
+    return found;
+}
+
+// Checks every key of the batch.
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t HashMap< KeyType, ValueType, Hasher>::containsMany(const std::vector<LookupKey>& keys,
+                                                          std::vector<bool>& found) const {
+    std::vector<const std::pair<KeyType, ValueType>*> pairs(keys.size());
+    this->findBatch(keys.data(), keys.size(), pairs.data());
+
+    size_t foundCount = 0;
+    found.resize(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        found[i] = pairs[i] != nullptr;
+        foundCount += pairs[i] != nullptr;
+    }
+    return foundCount;
+}
+
+// Visits the current table, then the old buckets not migrated yet.
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::forEach(const std::function<void(const KeyType&, const ValueType&)>& visit) const {
+    for (const Bucket& bucket : this->table) {
+        for (const auto& pair : bucket) {
+            visit(pair.first, pair.second);
+        }
+    }
+    for (size_t i = this->rehashIndex; i < this->oldTable.size(); i++) {
+        for (const auto& pair : this->oldTable[i]) {
+            visit(pair.first, pair.second);
+        }
+    }
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t HashMap< KeyType, ValueType, Hasher>::scanBucketCount() const {
+    return this->table.size() + this->oldTable.size() - this->rehashIndex;
+}
+
+// Each worker walks its own range of scan buckets, so the old table of a resize in
+// progress is split between the workers like the current one
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::parallelForEach(
+        const std::function<void(size_t worker, const KeyType&, const ValueType&)>& visit, size_t threads) const {
+    runInParallel(this->scanBucketCount(), threads, MIN_BUCKETS_PER_THREAD, [&](size_t worker, size_t begin, size_t end) {
+        forEachScanBucket(*this, begin, end, [&](const Bucket& bucket) {
+            for (const auto& pair : bucket) {
+                visit(worker, pair.first, pair.second);
+            }
+        });
+    });
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::parallelForEach(
+        const std::function<void(size_t worker, const KeyType&, ValueType&)>& visit, size_t threads) {
+    runInParallel(this->scanBucketCount(), threads, MIN_BUCKETS_PER_THREAD, [&](size_t worker, size_t begin, size_t end) {
+        forEachScanBucket(*this, begin, end, [&](Bucket& bucket) {
+            for (auto& pair : bucket) {
+                visit(worker, pair.first, pair.second);
+            }
+        });
+    });
 }
 
 // Clears all elements from the hash map and resets the table.
-template<typename KeyType, typename ValueType>
-void HashMap< KeyType, ValueType>::clear() {
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::clear() {
     for (auto& bucket : this->table) {
         bucket.clear();
     }
     this->table.clear();
     this->table.resize(tableSize);
+    std::vector<Bucket>().swap(this->oldTable);
+    this->rehashIndex = 0;
     this->numElements = 0;
 }
 
 // Returns the number of key-value pairs stored.
-template<typename KeyType, typename ValueType>
-size_t HashMap< KeyType, ValueType>::getSize() const {
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t HashMap< KeyType, ValueType, Hasher>::getSize() const {
     return this->numElements;
 }
 
 // Returns the current number of buckets in the table.
-template<typename KeyType, typename ValueType>
-size_t HashMap< KeyType, ValueType>::getTableSize() const {
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t HashMap< KeyType, ValueType, Hasher>::getTableSize() const {
     return this->table.size();
 }
 
+// Enables or disables incremental resizing; disabling finishes a pending migration.
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::setIncrementalResize(bool enabled) {
+    this->incrementalResize = enabled;
+    if (!enabled) {
+        this->rehashStep(this->oldTable.size());
+    }
+}
+
+// Returns true while a resize is migrating entries out of the old table.
+template<typename KeyType, typename ValueType, typename Hasher>
+bool HashMap< KeyType, ValueType, Hasher>::isRehashing() const {
+    return !this->oldTable.empty();
+}
+
+// Grows the table once so that 'count' elements fit without further resizes.
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::reserve(size_t count) {
+    size_t newSize = this->bucketsFor(count);
+    if (newSize > this->tableSize) {
+        this->resize(newSize);
+    }
+}
+
+// Resizes the table to 'buckets' buckets (rounded up to a power of two), but never
+// below what the current elements need under the maximum load factor.
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::rehash(size_t buckets) {
+    size_t newSize = roundUpToPowerOfTwo(buckets, MIN_TABLE_SIZE);
+    size_t needed = this->bucketsFor(this->numElements);
+    if (newSize < needed) {
+        newSize = needed;
+    }
+    if (newSize != this->tableSize) {
+        this->resize(newSize);
+    }
+}
+
+// Sets the grow and shrink thresholds; the gap between them prevents resize thrashing.
+// A pending migration is finished first, since its step was sized for the old limits.
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::setLoadFactors(double maxLoad, double minLoad) {
+    if (!(maxLoad > 0.0) || !(minLoad >= 0.0) || !(2 * minLoad < maxLoad)) {
+        throw std::invalid_argument("Load factors must satisfy 0 <= 2 * minLoad < maxLoad");
+    }
+    this->rehashStep(this->oldTable.size());
+    this->maxLoadFactor = maxLoad;
+    this->minLoadFactor = minLoad;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+double HashMap< KeyType, ValueType, Hasher>::getMaxLoadFactor() const {
+    return this->maxLoadFactor;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+double HashMap< KeyType, ValueType, Hasher>::getMinLoadFactor() const {
+    return this->minLoadFactor;
+}
+
+// Enables or disables shrinking the table when elements are removed.
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::setAutoShrink(bool enabled) {
+    this->rehashStep(this->oldTable.size());   // The migration step was sized for the old policy
+    this->autoShrink = enabled;
+}
+
+// Writes the offsets of every bucket, then the records bucket by bucket. Entries of a
+// resize in progress are sorted into their buckets of the current table first.
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::saveSnapshot(const std::string& path) const {
+    using KeyCodec = SnapshotCodec<KeyType>;
+    using ValueCodec = SnapshotCodec<ValueType>;
+    using Entry = std::pair<size_t, const std::pair<KeyType, ValueType>*>;
+
+    std::vector<Entry> pending;
+    for (size_t i = this->rehashIndex; i < this->oldTable.size(); i++) {
+        for (const auto& pair : this->oldTable[i]) {
+            pending.push_back(Entry(bucketIndex(this->hasher(pair.first), this->tableSize), &pair));
+        }
+    }
+    std::stable_sort(pending.begin(), pending.end(),
+                     [](const Entry& a, const Entry& b) { return a.first < b.first; });
+
+    std::vector<uint64_t> offsets(this->tableSize + 1, 0);
+    for (size_t i = 0; i < this->tableSize; i++) {
+        for (const auto& pair : this->table[i]) {
+            offsets[i + 1] += KeyCodec::encodedSize(pair.first) + ValueCodec::encodedSize(pair.second);
+        }
+    }
+    for (const Entry& entry : pending) {
+        offsets[entry.first + 1] += KeyCodec::encodedSize(entry.second->first)
+                                    + ValueCodec::encodedSize(entry.second->second);
+    }
+    for (size_t i = 0; i < this->tableSize; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+
+    SnapshotHeader header = SnapshotHeader();
+    header.kind = SNAPSHOT_MAP;
+    header.keyType = KeyCodec::TYPE_ID;
+    header.valueType = ValueCodec::TYPE_ID;
+    header.tableSize = this->tableSize;
+    header.numElements = this->numElements;
+    header.hasherCheck = this->hasher(KeyCodec::sampleKey());
+    SnapshotWriter writer(path, header);
+    writer.append(offsets.data(), offsets.size() * sizeof(uint64_t));
+
+    std::vector<char> record;
+    auto writeRecord = [&](const std::pair<KeyType, ValueType>& pair) {
+        record.resize(KeyCodec::encodedSize(pair.first) + ValueCodec::encodedSize(pair.second));
+        ValueCodec::encode(pair.second, KeyCodec::encode(pair.first, record.data()));
+        writer.append(record.data(), record.size());
+    };
+    size_t next = 0;
+    for (size_t i = 0; i < this->tableSize; i++) {
+        for (const auto& pair : this->table[i]) {
+            writeRecord(pair);
+        }
+        for (; next < pending.size() && pending[next].first == i; next++) {
+            writeRecord(*pending[next].second);
+        }
+    }
+    writer.finish();
+}
+
+// Decodes every record into a new table, then swaps it in: a bad file leaves the map as it was.
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::loadSnapshot(const std::string& path) {
+    using KeyCodec = SnapshotCodec<KeyType>;
+    using ValueCodec = SnapshotCodec<ValueType>;
+
+    SnapshotFile file(path);
+    file.expect(SNAPSHOT_MAP, KeyCodec::TYPE_ID, ValueCodec::TYPE_ID, this->hasher(KeyCodec::sampleKey()));
+    file.verifyChecksum();
+    size_t size = static_cast<size_t>(file.getHeader().tableSize);
+    if ((size & (size - 1)) != 0) {
+        throw std::runtime_error("Truncated or damaged snapshot: " + path);
+    }
+
+    std::vector<Bucket> loaded(size);
+    size_t count = 0;
+    for (size_t i = 0; i < size; i++) {
+        uint64_t begin = file.bucketBegin(i), end = file.bucketBegin(i + 1);
+        if (begin > end || end > file.bucketBegin(size)) {
+            throw std::runtime_error("Truncated or damaged snapshot: " + path);
+        }
+        const char* record = file.records() + begin;
+        const char* bucketEnd = file.records() + end;
+        while (record < bucketEnd) {
+            typename KeyCodec::View key;
+            typename ValueCodec::View value;
+            record = KeyCodec::decode(record, bucketEnd, key);
+            if (record != nullptr) {
+                record = ValueCodec::decode(record, bucketEnd, value);
+            }
+            if (record == nullptr) {
+                throw std::runtime_error("Truncated or damaged snapshot: " + path);
+            }
+            loaded[i].emplace_back(KeyType(key), ValueType(value));
+            count++;
+        }
+    }
+    if (count != file.getHeader().numElements) {
+        throw std::runtime_error("Truncated or damaged snapshot: " + path);
+    }
+
+    this->table.swap(loaded);
+    this->tableSize = size;
+    this->numElements = count;
+    std::vector<Bucket>().swap(this->oldTable);
+    this->rehashIndex = 0;
+}
+
+// One pass over the bucket sizes; std::list::size() is constant time, so no node is visited.
+template<typename KeyType, typename ValueType, typename Hasher>
+HashTableStats HashMap< KeyType, ValueType, Hasher>::getStats() const {
+    HashTableStats stats;
+    size_t homeBuckets = 0;
+    for (const Bucket& bucket : this->table) {
+        stats.addBucket(bucket.size());
+        homeBuckets += !bucket.empty();
+    }
+    for (size_t i = this->rehashIndex; i < this->oldTable.size(); i++) {
+        stats.addBucket(this->oldTable[i].size());
+        homeBuckets += !this->oldTable[i].empty();
+    }
+    size_t oldBuckets = this->isRehashing() ? this->oldTable.size() - this->rehashIndex : 0;
+    stats.finish(this->numElements, this->tableSize + oldBuckets, homeBuckets, this->resizeCounters);
+    return stats;
+}
+
 // Prints the content of each bucket for debugging.
-template<typename KeyType, typename ValueType>
-void HashMap< KeyType, ValueType>::print() const {
+template<typename KeyType, typename ValueType, typename Hasher>
+void HashMap< KeyType, ValueType, Hasher>::print() const {
     for (size_t i = 0; i < this->table.size(); i++) {
         std::cout << "Bucket " << i << ": ";
         for (const auto& pair : this->table[i]) {
@@ -158,4 +602,11 @@ void HashMap< KeyType, ValueType>::print() const {
         }
         std::cout << std::endl;
     }
+    for (size_t i = this->rehashIndex; i < this->oldTable.size(); i++) {
+        std::cout << "Old bucket " << i << ": ";
+        for (const auto& pair : this->oldTable[i]) {
+            std::cout << "(" << pair.first << ", " << pair.second << ") ";
+        }
+        std::cout << std::endl;
+    }
 }
\ No newline at end of file
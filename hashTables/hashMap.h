@@ -1,42 +1,280 @@
 #pragma once
+#include <cstddef>   // For size_t, std::ptrdiff_t
+#include <functional>
+#include <iterator>  // For std::forward_iterator_tag
+#include <type_traits>
 #include <utility>   // For std::pair
 #include <stdexcept>
+#include <string>
 #include <vector>
 #include <list>
 #include <iostream>
+#include "hashFunctions.h"
+#include "hashTableStats.h"
 
 
-template<typename KeyType, typename ValueType>
+// Chained hash map. 'Hasher' returns a 64-bit hash for a key (see hashFunctions.h);
+// the number of buckets is a power of two, so a bucket is chosen by masking the hash.
+template<typename KeyType, typename ValueType, typename Hasher = DefaultHash<KeyType>>
 class HashMap {
+public:
+    // Argument type of lookups: std::string_view for std::string keys with the
+    // default hasher, so a lookup never has to build a std::string
+    using LookupKey = typename HasherLookupType<KeyType, Hasher>::type;
+
 private:
-    std::vector<std::list<std::pair<KeyType, ValueType>>> table;
-    size_t tableSize;
+    using Bucket = std::list<std::pair<KeyType, ValueType>>;
+
+    std::vector<Bucket> table;
+    size_t tableSize;     // Always a power of two
     size_t numElements;
+    Hasher hasher;
+
+    // Incremental resizing: while a resize is in progress the previous table is kept
+    // in oldTable, and its buckets from rehashIndex onwards still hold entries.
+    std::vector<Bucket> oldTable;
+    size_t rehashIndex;
+    size_t rehashStepSize;    // Old buckets migrated by each insert/remove (see rehashStepFor)
+    bool incrementalResize;
+
+    // Resize policy: grow above maxLoadFactor, shrink below minLoadFactor (unless
+    // autoShrink is off). 2 * minLoadFactor < maxLoadFactor, so a table that has just
+    // grown or shrunk is never immediately resized back.
+    double maxLoadFactor;
+    double minLoadFactor;
+    bool autoShrink;
+    const size_t MIN_TABLE_SIZE = 8;
+    const size_t REHASH_STEP = 4;     // Fewest old buckets migrated by each insert/remove
+    static const size_t BATCH_WIDTH = 16;   // Keys in flight at once in getMany/containsMany
+    ResizeCounters resizeCounters;
+
+    // Bucket index of a hash in a table of 'size' buckets: the low bits of the hash
+    static size_t bucketIndex(uint64_t hash, size_t size);
+
+    // Pair holding 'key' in either table, or nullptr
+    const std::pair<KeyType, ValueType>* findPair(const LookupKey& key, uint64_t hash) const;
 
-    const double MAX_LOAD_FACTOR = 0.7;
-    const double MIN_LOAD_FACTOR = 0.3;
-    const size_t MIN_TABLE_SIZE = 5;
+    // Looks up 'count' keys as a software pipeline: hash a key and prefetch its bucket,
+    // later prefetch the bucket's first node, later still search it. The cache misses
+    // of about BATCH_WIDTH keys overlap instead of being paid one key at a time.
+    void findBatch(const LookupKey* keys, size_t count, const std::pair<KeyType, ValueType>** pairs) const;
 
-    size_t hashFunction(const KeyType& key) const;
+    // Appends a pair whose key is known to be absent, growing the table first if
+    // needed; returns a pointer to the stored value
+    ValueType* insertNew(const KeyType& key, const ValueType& value, uint64_t hash);
+
+    // Smallest table size that keeps 'count' elements at or below maxLoadFactor
+    size_t bucketsFor(size_t count) const;
+
+    // Starts moving every entry into a table of 'newSize' buckets. Without
+    // incremental resizing the move completes immediately.
+    void resize(size_t newSize);
+
+    // Moves up to 'buckets' old buckets into the current table
+    void rehashStep(size_t buckets);
+
+    // Old buckets each insert/remove must migrate so that a migration of 'oldBuckets'
+    // buckets ends before the current table can reach either load-factor limit
+    size_t rehashStepFor(size_t oldBuckets) const;
 
     void resizeUp();
 
     void resizeDown();
 
+    static const size_t MIN_BUCKETS_PER_THREAD = 1 << 12;   // parallelForEach: smaller ranges use fewer threads
+
+    // Buckets in iteration order ("scan buckets"): the current table, then the old
+    // buckets a resize in progress has not migrated yet
+    size_t scanBucketCount() const;
+
+    // Calls visit(bucket) for scan buckets begin..end - 1 of 'map' (a HashMap or a
+    // const HashMap), as a plain loop over each table
+    template<typename Map, typename Visit>
+    static void forEachScanBucket(Map& map, size_t begin, size_t end, Visit visit) {
+        size_t tableBuckets = map.table.size();
+        for (size_t i = begin; i < end && i < tableBuckets; i++) {
+            visit(map.table[i]);
+        }
+        for (size_t i = begin > tableBuckets ? begin : tableBuckets; i < end; i++) {
+            visit(map.oldTable[map.rehashIndex + i - tableBuckets]);
+        }
+    }
+
 public:
-    explicit HashMap(size_t size = 101);
+    // Forward iterator over the entries, in scan bucket order (see scanBucketCount). Any
+    // insert, remove or resize invalidates every iterator. The key of an entry must not
+    // be changed through an iterator; the value may be. Defined here so that a loop over
+    // the map inlines.
+    template<bool IsConst>
+    class Iterator {
+    private:
+        using Map = typename std::conditional<IsConst, const HashMap, HashMap>::type;
+        using BucketPointer = typename std::conditional<IsConst, const Bucket*, Bucket*>::type;
+        using BucketIterator = typename std::conditional<IsConst, typename Bucket::const_iterator,
+                                                         typename Bucket::iterator>::type;
+
+        Map* map;
+        BucketPointer bucket;       // Bucket of 'current'; nullptr at the end
+        BucketPointer tableEnd;     // End of the table 'bucket' is in
+        BucketIterator current;     // Value-initialised at the end
+
+        friend class HashMap;
+
+        // Constructor: the first entry of the map, or the end if 'atEnd'
+        Iterator(Map* map, bool atEnd) : map(map), bucket(nullptr), tableEnd(nullptr), current() {
+            if (atEnd || map->table.empty()) {
+                return;
+            }
+            this->bucket = map->table.data();
+            this->tableEnd = map->table.data() + map->table.size();
+            this->current = this->bucket->begin();
+            this->skipEmptyBuckets();
+        }
+
+        // Moves past the end of empty buckets, from the current table on to the old
+        // buckets of a resize in progress, to the next entry or to the end
+        void skipEmptyBuckets() {
+            while (this->current == this->bucket->end()) {
+                if (++this->bucket == this->tableEnd) {
+                    BucketPointer oldEnd = this->map->oldTable.data() + this->map->oldTable.size();
+                    if (this->tableEnd == oldEnd || this->map->rehashIndex == this->map->oldTable.size()) {
+                        this->bucket = nullptr;
+                        this->current = BucketIterator();
+                        return;
+                    }
+                    this->bucket = this->map->oldTable.data() + this->map->rehashIndex;
+                    this->tableEnd = oldEnd;
+                }
+                this->current = this->bucket->begin();
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<KeyType, ValueType>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const value_type*, value_type*>::type;
+        using reference = typename std::conditional<IsConst, const value_type&, value_type&>::type;
+
+        Iterator() : map(nullptr), bucket(nullptr), tableEnd(nullptr), current() { }
+
+        // An iterator converts to a const_iterator
+        template<bool WasConst, typename = typename std::enable_if<IsConst && !WasConst>::type>
+        Iterator(const Iterator<WasConst>& other)
+            : map(other.map), bucket(other.bucket), tableEnd(other.tableEnd), current(other.current) { }
+
+        reference operator*() const {
+            return *this->current;
+        }
+
+        pointer operator->() const {
+            return &*this->current;
+        }
+
+        Iterator& operator++() {
+            ++this->current;
+            this->skipEmptyBuckets();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator before = *this;
+            ++*this;
+            return before;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return this->bucket == other.bucket && this->current == other.current;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return !(*this == other);
+        }
+
+        template<bool> friend class Iterator;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    iterator begin() {
+        return iterator(this, false);
+    }
+
+    iterator end() {
+        return iterator(this, true);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this, false);
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, true);
+    }
+
+    const_iterator cbegin() const {
+        return this->begin();
+    }
+
+    const_iterator cend() const {
+        return this->end();
+    }
+
+    // Constructor: the requested number of buckets is rounded up to a power of two
+    explicit HashMap(size_t size = 101, const Hasher& hasher = Hasher());
 
     ~HashMap();
 
     double getLoadFactor() const;
 
+    // insert: Adds the pair if the key is absent; an existing value is kept
     void insert(const KeyType& key, const ValueType& value);
 
-    void remove(const KeyType& key);
+    // tryEmplace: Adds the pair if the key is absent. Returns a pointer to the
+    // key's value (new or existing) and whether it was inserted.
+    std::pair<ValueType*, bool> tryEmplace(const KeyType& key, const ValueType& value = ValueType());
+
+    // insertOrAssign: Adds the pair, or overwrites the value of an existing key.
+    // Returns a pointer to the value and whether the key was new.
+    std::pair<ValueType*, bool> insertOrAssign(const KeyType& key, const ValueType& value);
+
+    void remove(const LookupKey& key);
+
+    // find: Returns a pointer to the value of the key, or nullptr if it is absent.
+    // The pointer stays valid until the key is removed or the map is cleared.
+    ValueType* find(const LookupKey& key);
+
+    const ValueType* find(const LookupKey& key) const;
+
+    // get: Returns a reference to the value of the key; throws if not found
+    ValueType& get(const LookupKey& key);
+
+    bool contains(const LookupKey& key) const;
 
-    ValueType& get(const KeyType& key);
+    // getMany: Looks up a batch of keys. values[i] points to the value of keys[i], or
+    // is nullptr if that key is absent. Returns the number of keys found.
+    size_t getMany(const std::vector<LookupKey>& keys, std::vector<const ValueType*>& values) const;
 
-    bool contains(const KeyType& key) const;
+    // containsMany: found[i] tells whether keys[i] is in the map. Returns the number found.
+    size_t containsMany(const std::vector<LookupKey>& keys, std::vector<bool>& found) const;
+
+    // forEach: Calls 'visit' with every key and value, in bucket order (old buckets of a
+    // resize in progress last). The map must not be modified during the walk.
+    void forEach(const std::function<void(const KeyType&, const ValueType&)>& visit) const;
+
+    // parallelForEach: Calls visit(worker, key, value) for every entry from up to
+    // 'threads' threads, each walking its own contiguous range of buckets (ranges of
+    // at least 4096 buckets; the calling thread takes the first). 'worker' is in
+    // 0..threads - 1, so callers can keep one accumulator per worker and combine them
+    // afterwards, without locking. The map must not be modified during the walk; an
+    // exception thrown by 'visit' is rethrown once every thread has finished.
+    void parallelForEach(const std::function<void(size_t worker, const KeyType&, const ValueType&)>& visit,
+                         size_t threads) const;
+
+    // parallelForEach: The same, with the values modifiable in place (each entry is
+    // visited by exactly one thread)
+    void parallelForEach(const std::function<void(size_t worker, const KeyType&, ValueType&)>& visit, size_t threads);
 
     void clear();
 
@@ -44,5 +282,47 @@ public:
 
     size_t getTableSize() const;
 
+    // setIncrementalResize: When enabled, a resize allocates the new table and then
+    // each insert/remove migrates a few old buckets, instead of rehashing every entry
+    // at once. Disabling it finishes any migration in progress.
+    void setIncrementalResize(bool enabled);
+
+    // isRehashing: Returns true while entries remain in the old table
+    bool isRehashing() const;
+
+    // reserve: Grows the table once so that 'count' elements fit without further resizes
+    void reserve(size_t count);
+
+    // rehash: Resizes the table to at least 'buckets' buckets, and at least enough
+    // for the current elements under the maximum load factor (it may shrink the table)
+    void rehash(size_t buckets);
+
+    // setLoadFactors: Sets the grow and shrink thresholds. Throws std::invalid_argument
+    // unless 0 <= minLoad, 2 * minLoad < maxLoad and maxLoad > 0.
+    void setLoadFactors(double maxLoad, double minLoad);
+
+    double getMaxLoadFactor() const;
+
+    double getMinLoadFactor() const;
+
+    // setAutoShrink: When disabled, remove never shrinks the table (rehash still can)
+    void setAutoShrink(bool enabled);
+
+    // saveSnapshot: Writes the buckets to 'path' in the snapshot format of hashSnapshot.h.
+    // Entries still in the old table of a resize are written to their new bucket.
+    // Throws std::runtime_error if the file cannot be written.
+    void saveSnapshot(const std::string& path) const;
+
+    // loadSnapshot: Replaces the contents with a snapshot saved by a map of the same types
+    // and hasher. The buckets are rebuilt as saved, without hashing a key. Throws
+    // std::runtime_error, leaving the map unchanged, if the file is missing, damaged or
+    // holds another kind of map.
+    void loadSnapshot(const std::string& path);
+
+    // getStats: Bucket length histogram, probe lengths, collision rate and resize
+    // history. Buckets of the old table still holding entries during a resize count
+    // as buckets of their own.
+    HashTableStats getStats() const;
+
     void print() const;
 };
\ No newline at end of file
@@ -1,58 +1,119 @@
 #include <cstddef>   // For size_t
+#include <cmath>     // For std::ceil, std::floor
+#include <cstdint>   // For uint64_t
+#include <algorithm> // For std::stable_sort
+#include <string>
+#include <utility>   // For std::pair
 #include <stdexcept>
 #include <vector>
 #include <list>
 #include <iostream>
+#include "hashFunctions.h"
 #include "hashSet.h"
+#include "parallelRange.h"
+#include "hashSnapshot.h"
+
+// Buckets are value % tableSize: there is no hasher for a snapshot to check
+static const uint64_t SET_HASHER_CHECK = 0;
 
 // Hash function: computes an index for a given key
 size_t HashSet::hashFunction(const int& value) const {
     return value % this->tableSize;
 };
 
-void HashSet::resizeUp() {
-    size_t newSize = this->tableSize * 2; // Doubles the table size
-    std::vector<std::list<int>> newTable(newSize);
-
-    // Reinsert all elements in the new table
-    for (const auto& bucket : this->table) {
-        for (int value : bucket) {
-            size_t newBucketId = value % newSize;
-            newTable[newBucketId].push_back(value);
+// Removes the value from the bucket; returns false if it is not there
+static bool eraseValue(std::list<int>& bucket, const int& value) {
+    for (auto it = bucket.begin(); it != bucket.end(); it++) {
+        if (*it == value) {
+            bucket.erase(it);
+            return true;
         }
     }
+    return false;
+};
 
-    size_t previousNumElements = this->numElements;
-    this->table = std::move(newTable);
-    this->tableSize = newSize;
-    this->numElements = previousNumElements;
-}
+// Smallest table size that keeps 'count' elements at or below maxLoadFactor
+size_t HashSet::bucketsFor(size_t count) const {
+    size_t needed = static_cast<size_t>(std::ceil(count / this->maxLoadFactor));
+    return needed < this->MIN_TABLE_SIZE ? this->MIN_TABLE_SIZE : needed;
+};
 
-void HashSet::resizeDown() {
-    size_t newSize = this->tableSize / 2; // Doubles the table size
+// Allocates a table of 'newSize' buckets and keeps the current one as the old table
+void HashSet::resize(size_t newSize) {
+    // A resize requested while another one is running finishes the first one
+    this->rehashStep(this->oldTable.size());
 
-    if (newSize < this->MIN_TABLE_SIZE) {
-        newSize = this->MIN_TABLE_SIZE;
+    this->resizeCounters.countResize(this->tableSize, newSize);
+    {
+        RehashTimer timer(this->resizeCounters);
+        this->oldTable = std::move(this->table);
+        this->table = std::vector<std::list<int>>(newSize);
     }
+    this->tableSize = newSize;
+    this->rehashIndex = 0;
+    this->rehashStepSize = this->rehashStepFor(this->oldTable.size());
 
-    std::vector<std::list<int>> newTable(newSize);
+    if (!this->incrementalResize) {
+        this->rehashStep(this->oldTable.size());
+    }
+};
 
-    // Reinsert all elements in the new table
-    for (const auto& bucket : this->table) {
-        for (int value : bucket) {
-            size_t newBucketId = value % newSize;
-            newTable[newBucketId].push_back(value);
+// Splices the nodes of up to 'buckets' old buckets into the current table (no allocation)
+void HashSet::rehashStep(size_t buckets) {
+    if (!this->isRehashing()) {
+        return;
+    }
+    RehashTimer timer(this->resizeCounters);
+    while (buckets > 0 && this->rehashIndex < this->oldTable.size()) {
+        std::list<int>& bucket = this->oldTable[this->rehashIndex];
+        while (!bucket.empty()) {
+            std::list<int>& target = this->table[hashFunction(bucket.front())];
+            target.splice(target.end(), bucket, bucket.begin());
         }
+        this->rehashIndex++;
+        buckets--;
     }
+    if (this->isRehashing() && this->rehashIndex == this->oldTable.size()) {
+        std::vector<std::list<int>>().swap(this->oldTable);
+        this->rehashIndex = 0;
+    }
+};
 
-    size_t previousNumElements = this->numElements;
-    this->table = std::move(newTable);
-    this->tableSize = newSize;
-    this->numElements = previousNumElements;
-}
+// Sized as in HashMap: an insert grows the table when it finds more than maxLoadFactor *
+// tableSize values, a remove shrinks it when fewer than minLoadFactor * tableSize remain,
+// both migrate before they check, and each moves towards at most one of the limits
+size_t HashSet::rehashStepFor(size_t oldBuckets) const {
+    double growAt = std::floor(this->maxLoadFactor * this->tableSize) + 1;     // Values an insert grows at
+    size_t operations = growAt > this->numElements ? static_cast<size_t>(growAt) - this->numElements + 1 : 1;
+    double shrinkAt = std::ceil(this->minLoadFactor * this->tableSize) - 1;    // Values a remove shrinks at
+    if (this->autoShrink && shrinkAt >= 0) {
+        size_t removes = shrinkAt < this->numElements ? this->numElements - static_cast<size_t>(shrinkAt) : 1;
+        operations = removes < operations ? removes : operations;
+    }
+    operations = operations > 1 ? operations - 1 : 1;    // One operation of slack for rounding in getLoadFactor
+    size_t step = (oldBuckets + operations - 1) / operations;
+    return step < this->REHASH_STEP ? this->REHASH_STEP : step;
+};
+
+void HashSet::resizeUp() {
+    this->resize(this->tableSize * 2); // Doubles the table size
+};
+
+void HashSet::resizeDown() {
+    size_t newSize = this->tableSize / 2; // Halves the table size
+
+    if (newSize < this->MIN_TABLE_SIZE) {
+        newSize = this->MIN_TABLE_SIZE;
+    }
+    if (newSize != this->tableSize) {
+        this->resize(newSize);
+    }
+};
 
 // Constructor: Initializes the hash table with a specified number of buckets (default: 101)
-HashSet::HashSet(size_t size) : table(size), tableSize(size), numElements(0) { };
+HashSet::HashSet(size_t size)
+    : table(size), tableSize(size), numElements(0), rehashIndex(0), rehashStepSize(0), incrementalResize(false),
+      maxLoadFactor(0.7), minLoadFactor(0.3), autoShrink(true) { };
 
 
 double HashSet::getLoadFactor() const {
@@ -64,8 +125,12 @@ void HashSet::insert(const int& value) {
     if (this->containsValue(value)) {
         return;
     }
+    this->insertNew(value);
+};
 
-    if (this->getLoadFactor() > this->MAX_LOAD_FACTOR) {
+void HashSet::insertNew(int value) {
+    this->rehashStep(this->rehashStepSize);
+    if (this->getLoadFactor() > this->maxLoadFactor) {
         resizeUp();
     }
     size_t bucketId = hashFunction(value);
@@ -79,21 +144,16 @@ void HashSet::remove(const int& value) {
         return;
     }
 
-    if (this->getLoadFactor() < this->MIN_LOAD_FACTOR) {
-        resizeDown();
+    // The value is in its current bucket, or in its old bucket if that one was not migrated yet
+    if (!eraseValue(this->table[hashFunction(value)], value) && this->isRehashing()) {
+        eraseValue(this->oldTable[static_cast<size_t>(value) % this->oldTable.size()], value);
     }
+    this->numElements--;
 
-    size_t bucketId = hashFunction(value);
-
-    std::list<int>& bucket = this->table[bucketId];
-    for (auto it = bucket.begin(); it != bucket.end();) {
-        if (*it == value) {
-            it = bucket.erase(it); // erase returns the next iterator
-            this->numElements--;
-            break;
-        } else {
-            it++;
-        }
+    // The load factor is checked after removing, so it reflects the remaining values
+    this->rehashStep(this->rehashStepSize);
+    if (this->autoShrink && this->getLoadFactor() < this->minLoadFactor) {
+        resizeDown();
     }
 };
 
@@ -116,9 +176,228 @@ bool HashSet::containsValue(const int& value) const {
             return true;
         }
     }
+    if (this->isRehashing()) {
+        size_t oldBucketId = static_cast<size_t>(value) % this->oldTable.size();
+        if (oldBucketId >= this->rehashIndex) {
+            for (const auto& val : this->oldTable[oldBucketId]) {
+                if (val == value) {
+                    return true;
+                }
+            }
+        }
+    }
     return false;
 };
 
+// containsMany: Software pipeline over the batch. A value's bucket is prefetched, DISTANCE
+// values later its first node, and DISTANCE values after that it is searched, so about
+// BATCH_WIDTH cache misses are in flight at once. Stages run oldest first, so a bucket
+// slot is reused only after its value has been searched.
+size_t HashSet::containsMany(const std::vector<int>& values, std::vector<bool>& found) const {
+    return this->containsBatch(values.data(), values.size(), found);
+};
+
+size_t HashSet::containsBatch(const int* values, size_t count, std::vector<bool>& found) const {
+    const size_t DISTANCE = BATCH_WIDTH / 2;
+    const std::list<int>* buckets[BATCH_WIDTH];
+    size_t foundCount = 0;
+    found.resize(count);
+
+    for (size_t step = 0; step < count + 2 * DISTANCE; step++) {
+        if (step >= 2 * DISTANCE) {
+            size_t i = step - 2 * DISTANCE;
+            found[i] = this->containsValue(values[i]);
+            foundCount += found[i];
+        }
+        if (step >= DISTANCE && step - DISTANCE < count) {
+            const std::list<int>* bucket = buckets[(step - DISTANCE) % BATCH_WIDTH];
+            if (!bucket->empty()) {
+                hashing::prefetch(&bucket->front());
+            }
+        }
+        if (step < count) {
+            buckets[step % BATCH_WIDTH] = &this->table[hashFunction(values[step])];
+            hashing::prefetch(buckets[step % BATCH_WIDTH]);
+        }
+    }
+    return foundCount;
+};
+
+// Each worker fills its own vector (neighbouring bits of a std::vector<bool> share a
+// word, so workers cannot write into one); the slices are copied together afterwards
+size_t HashSet::containsParallel(const std::vector<int>& values, std::vector<bool>& found, size_t threads) const {
+    if (threads <= 1 || values.size() < 2 * MIN_VALUES_PER_THREAD) {
+        return this->containsBatch(values.data(), values.size(), found);
+    }
+
+    std::vector<std::vector<bool>> partial(threads);
+    std::vector<size_t> begins(threads, 0);
+    std::vector<size_t> counts(threads, 0);
+    runInParallel(values.size(), threads, MIN_VALUES_PER_THREAD, [&](size_t worker, size_t begin, size_t end) {
+        begins[worker] = begin;
+        counts[worker] = this->containsBatch(values.data() + begin, end - begin, partial[worker]);
+    });
+    size_t foundCount = 0;
+    found.resize(values.size());
+    for (size_t worker = 0; worker < threads; worker++) {
+        for (size_t i = 0; i < partial[worker].size(); i++) {
+            found[begins[worker] + i] = partial[worker][i];
+        }
+        foundCount += counts[worker];
+    }
+    return foundCount;
+};
+
+size_t HashSet::scanBucketCount() const {
+    return this->table.size() + this->oldTable.size() - this->rehashIndex;
+};
+
+void HashSet::forEachScanBucket(size_t begin, size_t end, const std::function<void(const std::list<int>&)>& visit) const {
+    size_t tableBuckets = this->table.size();
+    for (size_t i = begin; i < end && i < tableBuckets; i++) {
+        visit(this->table[i]);
+    }
+    for (size_t i = begin > tableBuckets ? begin : tableBuckets; i < end; i++) {
+        visit(this->oldTable[this->rehashIndex + i - tableBuckets]);
+    }
+};
+
+// Each worker walks its own range of scan buckets, so the old table of a resize in
+// progress is split between the workers like the current one
+void HashSet::parallelForEach(const std::function<void(size_t worker, int value)>& visit, size_t threads) const {
+    runInParallel(this->scanBucketCount(), threads, MIN_BUCKETS_PER_THREAD, [&](size_t worker, size_t begin, size_t end) {
+        this->forEachScanBucket(begin, end, [&](const std::list<int>& bucket) {
+            for (int value : bucket) {
+                visit(worker, value);
+            }
+        });
+    });
+};
+
+std::vector<int> HashSet::collectValues() const {
+    std::vector<int> values;
+    values.reserve(this->numElements);
+    for (int value : *this) {
+        values.push_back(value);
+    }
+    return values;
+};
+
+// replaceValues: One new table sized for the result, instead of a resize after every
+// few removals. Without autoShrink the table keeps at least its current size.
+void HashSet::replaceValues(const std::vector<int>& values) {
+    size_t newSize = this->bucketsFor(values.size());
+    if (!this->autoShrink && newSize < this->tableSize) {
+        newSize = this->tableSize;
+    }
+    this->resizeCounters.countResize(this->tableSize, newSize);
+    RehashTimer timer(this->resizeCounters);
+    std::vector<std::list<int>>(newSize).swap(this->table);
+    std::vector<std::list<int>>().swap(this->oldTable);
+    this->tableSize = newSize;
+    this->rehashIndex = 0;
+    for (int value : values) {
+        this->table[hashFunction(value)].push_back(value);
+    }
+    this->numElements = values.size();
+};
+
+// unionWith: Every value of 'other' must be visited; only the missing ones are inserted
+void HashSet::unionWith(const HashSet& other, size_t threads) {
+    if (&other == this) {
+        return;
+    }
+    std::vector<int> values = other.collectValues();
+    std::vector<bool> found;
+    size_t present = this->containsParallel(values, found, threads);
+    this->reserve(this->numElements + values.size() - present);
+    for (size_t i = 0; i < values.size(); i++) {
+        if (!found[i]) {
+            this->insertNew(values[i]);
+        }
+    }
+};
+
+// intersectWith: The values of the smaller set that the larger one also holds
+void HashSet::intersectWith(const HashSet& other, size_t threads) {
+    if (&other == this) {
+        return;
+    }
+    const HashSet& smaller = this->numElements <= other.numElements ? *this : other;
+    const HashSet& larger = this->numElements <= other.numElements ? other : *this;
+    std::vector<int> values = smaller.collectValues();
+    std::vector<bool> found;
+    larger.containsParallel(values, found, threads);
+
+    std::vector<int> kept;
+    for (size_t i = 0; i < values.size(); i++) {
+        if (found[i]) {
+            kept.push_back(values[i]);
+        }
+    }
+    this->replaceValues(kept);
+};
+
+// differenceWith: A smaller 'other' is walked and its values removed one by one; a
+// smaller 'this' is walked and rebuilt from the values 'other' does not hold
+void HashSet::differenceWith(const HashSet& other, size_t threads) {
+    if (&other == this) {
+        this->clear();
+        return;
+    }
+    std::vector<bool> found;
+    if (other.numElements < this->numElements) {
+        std::vector<int> values = other.collectValues();
+        this->containsParallel(values, found, threads);
+        for (size_t i = 0; i < values.size(); i++) {
+            if (found[i]) {
+                int value = values[i];
+                if (!eraseValue(this->table[hashFunction(value)], value) && this->isRehashing()) {
+                    eraseValue(this->oldTable[static_cast<size_t>(value) % this->oldTable.size()], value);
+                }
+                this->numElements--;
+            }
+        }
+        // The migration step assumed one rehashStep per remove, so a bulk removal finishes it
+        this->rehashStep(this->oldTable.size());
+        if (this->autoShrink && this->getLoadFactor() < this->minLoadFactor) {
+            size_t newSize = this->bucketsFor(this->numElements);
+            if (newSize < this->tableSize) {
+                this->resize(newSize);
+            }
+        }
+        return;
+    }
+
+    std::vector<int> values = this->collectValues();
+    other.containsParallel(values, found, threads);
+    std::vector<int> kept;
+    for (size_t i = 0; i < values.size(); i++) {
+        if (!found[i]) {
+            kept.push_back(values[i]);
+        }
+    }
+    this->replaceValues(kept);
+};
+
+size_t HashSet::intersectionSize(const HashSet& other, size_t threads) const {
+    if (&other == this) {
+        return this->numElements;
+    }
+    const HashSet& smaller = this->numElements <= other.numElements ? *this : other;
+    const HashSet& larger = this->numElements <= other.numElements ? other : *this;
+    std::vector<bool> found;
+    return larger.containsParallel(smaller.collectValues(), found, threads);
+};
+
+size_t HashSet::unionSize(const HashSet& other, size_t threads) const {
+    return this->numElements + other.numElements - this->intersectionSize(other, threads);
+};
+
+size_t HashSet::differenceSize(const HashSet& other, size_t threads) const {
+    return this->numElements - this->intersectionSize(other, threads);
+};
+
 // clear: Removes all key-value pairs from the hash table
 void HashSet::clear() {
     for (auto &bucket : this->table) {
@@ -126,6 +405,8 @@ void HashSet::clear() {
     }
     this->table.clear();
     this->table.resize(tableSize);
+    std::vector<std::list<int>>().swap(this->oldTable);
+    this->rehashIndex = 0;
     this->numElements = 0;
 };
 
@@ -138,6 +419,157 @@ size_t HashSet::getTableSize() const {
     return this->table.size();
 }
 
+// setIncrementalResize: Enables or disables incremental resizing; disabling finishes a pending migration
+void HashSet::setIncrementalResize(bool enabled) {
+    this->incrementalResize = enabled;
+    if (!enabled) {
+        this->rehashStep(this->oldTable.size());
+    }
+};
+
+bool HashSet::isRehashing() const {
+    return !this->oldTable.empty();
+};
+
+// reserve: Grows the table once so that 'count' values fit without further resizes
+void HashSet::reserve(size_t count) {
+    size_t newSize = this->bucketsFor(count);
+    if (newSize > this->tableSize) {
+        this->resize(newSize);
+    }
+};
+
+// rehash: Resizes the table to 'buckets' buckets, but never below what the current
+// values need under the maximum load factor
+void HashSet::rehash(size_t buckets) {
+    size_t newSize = buckets;
+    size_t needed = this->bucketsFor(this->numElements);
+    if (newSize < needed) {
+        newSize = needed;
+    }
+    if (newSize != this->tableSize) {
+        this->resize(newSize);
+    }
+};
+
+// setLoadFactors: Sets the grow and shrink thresholds; the gap between them prevents resize thrashing
+void HashSet::setLoadFactors(double maxLoad, double minLoad) {
+    if (!(maxLoad > 0.0) || !(minLoad >= 0.0) || !(2 * minLoad < maxLoad)) {
+        throw std::invalid_argument("Load factors must satisfy 0 <= 2 * minLoad < maxLoad");
+    }
+    this->rehashStep(this->oldTable.size());   // The migration step was sized for the old limits
+    this->maxLoadFactor = maxLoad;
+    this->minLoadFactor = minLoad;
+};
+
+double HashSet::getMaxLoadFactor() const {
+    return this->maxLoadFactor;
+};
+
+double HashSet::getMinLoadFactor() const {
+    return this->minLoadFactor;
+};
+
+// setAutoShrink: Enables or disables shrinking the table when values are removed
+void HashSet::setAutoShrink(bool enabled) {
+    this->rehashStep(this->oldTable.size());   // The migration step was sized for the old policy
+    this->autoShrink = enabled;
+};
+
+// saveSnapshot: Offsets of every bucket, then the values bucket by bucket
+void HashSet::saveSnapshot(const std::string& path) const {
+    using Codec = SnapshotCodec<int>;
+    std::vector<std::pair<size_t, int>> pending;
+    for (size_t i = this->rehashIndex; i < this->oldTable.size(); i++) {
+        for (const int& value : this->oldTable[i]) {
+            pending.push_back(std::make_pair(hashFunction(value), value));
+        }
+    }
+    std::stable_sort(pending.begin(), pending.end(),
+                     [](const std::pair<size_t, int>& a, const std::pair<size_t, int>& b) { return a.first < b.first; });
+
+    std::vector<uint64_t> offsets(this->tableSize + 1, 0);
+    for (size_t i = 0; i < this->tableSize; i++) {
+        offsets[i + 1] = this->table[i].size() * sizeof(int);
+    }
+    for (const auto& entry : pending) {
+        offsets[entry.first + 1] += sizeof(int);
+    }
+    for (size_t i = 0; i < this->tableSize; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+
+    SnapshotHeader header = SnapshotHeader();
+    header.kind = SNAPSHOT_SET;
+    header.keyType = Codec::TYPE_ID;
+    header.valueType = SNAPSHOT_NO_VALUE;
+    header.tableSize = this->tableSize;
+    header.numElements = this->numElements;
+    header.hasherCheck = SET_HASHER_CHECK;
+    SnapshotWriter writer(path, header);
+    writer.append(offsets.data(), offsets.size() * sizeof(uint64_t));
+
+    size_t next = 0;
+    for (size_t i = 0; i < this->tableSize; i++) {
+        for (const int& value : this->table[i]) {
+            writer.append(&value, sizeof(int));
+        }
+        for (; next < pending.size() && pending[next].first == i; next++) {
+            writer.append(&pending[next].second, sizeof(int));
+        }
+    }
+    writer.finish();
+};
+
+// loadSnapshot: Builds the new table aside and swaps it in once every bucket decoded
+void HashSet::loadSnapshot(const std::string& path) {
+    SnapshotFile file(path);
+    file.expect(SNAPSHOT_SET, SnapshotCodec<int>::TYPE_ID, SNAPSHOT_NO_VALUE, SET_HASHER_CHECK);
+    file.verifyChecksum();
+    size_t size = static_cast<size_t>(file.getHeader().tableSize);
+
+    std::vector<std::list<int>> loaded(size);
+    size_t count = 0;
+    for (size_t i = 0; i < size; i++) {
+        uint64_t begin = file.bucketBegin(i), end = file.bucketBegin(i + 1);
+        if (begin > end || end > file.bucketBegin(size) || (end - begin) % sizeof(int) != 0) {
+            throw std::runtime_error("Truncated or damaged snapshot: " + path);
+        }
+        for (const char* record = file.records() + begin; record < file.records() + end; record += sizeof(int)) {
+            int value = 0;
+            SnapshotCodec<int>::decode(record, file.records() + end, value);
+            loaded[i].push_back(value);
+            count++;
+        }
+    }
+    if (count != file.getHeader().numElements) {
+        throw std::runtime_error("Truncated or damaged snapshot: " + path);
+    }
+
+    this->table.swap(loaded);
+    this->tableSize = size;
+    this->numElements = count;
+    std::vector<std::list<int>>().swap(this->oldTable);
+    this->rehashIndex = 0;
+};
+
+// getStats: Old buckets still holding values during a resize count as buckets of their own
+HashTableStats HashSet::getStats() const {
+    HashTableStats stats;
+    size_t homeBuckets = 0;
+    for (const auto& bucket : this->table) {
+        stats.addBucket(bucket.size());
+        homeBuckets += !bucket.empty();
+    }
+    for (size_t i = this->rehashIndex; i < this->oldTable.size(); i++) {
+        stats.addBucket(this->oldTable[i].size());
+        homeBuckets += !this->oldTable[i].empty();
+    }
+    size_t oldBuckets = this->isRehashing() ? this->oldTable.size() - this->rehashIndex : 0;
+    stats.finish(this->numElements, this->tableSize + oldBuckets, homeBuckets, this->resizeCounters);
+    return stats;
+};
+
 // print: Prints the contents of the hash table for debugging purposes.
 void HashSet::print() const {
     for (size_t i = 0; i < this->table.size(); i++) {
@@ -148,4 +580,12 @@ void HashSet::print() const {
         }
         std::cout << std::endl;
     }
+    for (size_t i = this->rehashIndex; i < this->oldTable.size(); i++) {
+        std::cout << "Old bucket " << i << ": ";
+
+        for (const auto &val : this->oldTable[i]) {
+            std::cout << val << " ";
+        }
+        std::cout << std::endl;
+    }
 };
\ No newline at end of file
@@ -1,9 +1,13 @@
 #pragma once
-#include <cstddef>   // For size_t
+#include <cstddef>   // For size_t, std::ptrdiff_t
+#include <functional>
+#include <iterator>  // For std::forward_iterator_tag
 #include <stdexcept>
+#include <string>
 #include <vector>
 #include <list>
 #include <utility>   // For std::pair
+#include "hashTableStats.h"
 
 // Templated HashTable class for generic key-value pairs
 class HashSet {
@@ -12,17 +16,168 @@ private:
     std::vector<std::list<int>> table;
     size_t tableSize;     // Number of buckets
     size_t numElements;   // Total number of key-value pairs stored
-    const double MAX_LOAD_FACTOR = 0.7;
-    const double MIN_LOAD_FACTOR = 0.3;
+
+    // Incremental resizing: while a resize is in progress the previous table is kept
+    // in oldTable, and its buckets from rehashIndex onwards still hold values.
+    std::vector<std::list<int>> oldTable;
+    size_t rehashIndex;
+    size_t rehashStepSize;    // Old buckets migrated by each insert/remove (see rehashStepFor)
+    bool incrementalResize;
+
+    // Resize policy: grow above maxLoadFactor, shrink below minLoadFactor (unless
+    // autoShrink is off). 2 * minLoadFactor < maxLoadFactor, so a table that has just
+    // grown or shrunk is never immediately resized back.
+    double maxLoadFactor;
+    double minLoadFactor;
+    bool autoShrink;
     const size_t MIN_TABLE_SIZE = 5;
+    const size_t REHASH_STEP = 4;     // Fewest old buckets migrated by each insert/remove
+    static const size_t BATCH_WIDTH = 16;   // Values in flight at once in containsMany
+    static const size_t MIN_VALUES_PER_THREAD = 1 << 16;   // Set algebra: smaller jobs use fewer threads
+    ResizeCounters resizeCounters;
 
     // Hash function: computes an index for a given key
     size_t hashFunction(const int& value) const;
 
+    // Smallest table size that keeps 'count' elements at or below maxLoadFactor
+    size_t bucketsFor(size_t count) const;
+
+    // Starts moving every value into a table of 'newSize' buckets. Without
+    // incremental resizing the move completes immediately.
+    void resize(size_t newSize);
+
+    // Moves up to 'buckets' old buckets into the current table
+    void rehashStep(size_t buckets);
+
+    // Old buckets each insert/remove must migrate so that a migration of 'oldBuckets'
+    // buckets ends before the current table can reach either load-factor limit
+    size_t rehashStepFor(size_t oldBuckets) const;
+
     void resizeUp();
     void resizeDown();
 
+    // Adds a value known to be absent, growing the table first if needed
+    void insertNew(int value);
+
+    // Batched lookup of values[0..count) (see containsMany); found is resized to 'count'
+    size_t containsBatch(const int* values, size_t count, std::vector<bool>& found) const;
+
+    // containsMany split across up to 'threads' threads, each taking a contiguous slice
+    size_t containsParallel(const std::vector<int>& values, std::vector<bool>& found, size_t threads) const;
+
+    // Every value, from the current table and from the old buckets of a resize in progress
+    std::vector<int> collectValues() const;
+
+    // Replaces the contents with 'values' (distinct) in a table sized for them
+    void replaceValues(const std::vector<int>& values);
+
+    static const size_t MIN_BUCKETS_PER_THREAD = 1 << 12;   // parallelForEach: smaller ranges use fewer threads
+
+    // Buckets in iteration order ("scan buckets"): the current table, then the old
+    // buckets a resize in progress has not migrated yet
+    size_t scanBucketCount() const;
+
+    // Calls visit(bucket) for scan buckets begin..end - 1, as a plain loop over each table
+    void forEachScanBucket(size_t begin, size_t end, const std::function<void(const std::list<int>&)>& visit) const;
+
 public:
+    // Forward iterator over the values, in scan bucket order (see scanBucketCount). Values
+    // cannot be changed through it. Any insert, remove or resize invalidates every
+    // iterator. Defined here so that a loop over the set inlines.
+    class const_iterator {
+    private:
+        const HashSet* set;
+        const std::list<int>* bucket;              // Bucket of 'current'; nullptr at the end
+        const std::list<int>* tableEnd;            // End of the table 'bucket' is in
+        std::list<int>::const_iterator current;    // Value-initialised at the end
+
+        friend class HashSet;
+
+        // Constructor: the first value of the set, or the end if 'atEnd'
+        const_iterator(const HashSet* set, bool atEnd) : set(set), bucket(nullptr), tableEnd(nullptr), current() {
+            if (atEnd || set->table.empty()) {
+                return;
+            }
+            this->bucket = set->table.data();
+            this->tableEnd = set->table.data() + set->table.size();
+            this->current = this->bucket->begin();
+            this->skipEmptyBuckets();
+        }
+
+        // Moves past the end of empty buckets, from the current table on to the old
+        // buckets of a resize in progress, to the next value or to the end
+        void skipEmptyBuckets() {
+            while (this->current == this->bucket->end()) {
+                if (++this->bucket == this->tableEnd) {
+                    const std::list<int>* oldEnd = this->set->oldTable.data() + this->set->oldTable.size();
+                    if (this->tableEnd == oldEnd || this->set->rehashIndex == this->set->oldTable.size()) {
+                        this->bucket = nullptr;
+                        this->current = std::list<int>::const_iterator();
+                        return;
+                    }
+                    this->bucket = this->set->oldTable.data() + this->set->rehashIndex;
+                    this->tableEnd = oldEnd;
+                }
+                this->current = this->bucket->begin();
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const int*;
+        using reference = const int&;
+
+        const_iterator() : set(nullptr), bucket(nullptr), tableEnd(nullptr), current() { }
+
+        reference operator*() const {
+            return *this->current;
+        }
+
+        pointer operator->() const {
+            return &*this->current;
+        }
+
+        const_iterator& operator++() {
+            ++this->current;
+            this->skipEmptyBuckets();
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator before = *this;
+            ++*this;
+            return before;
+        }
+
+        bool operator==(const const_iterator& other) const {
+            return this->bucket == other.bucket && this->current == other.current;
+        }
+
+        bool operator!=(const const_iterator& other) const {
+            return !(*this == other);
+        }
+    };
+
+    using iterator = const_iterator;
+
+    const_iterator begin() const {
+        return const_iterator(this, false);
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, true);
+    }
+
+    const_iterator cbegin() const {
+        return this->begin();
+    }
+
+    const_iterator cend() const {
+        return this->end();
+    }
+
     // Constructor: Initializes the hash table with a specified number of buckets (default: 101)
     explicit HashSet(size_t size = 101);
 
@@ -44,6 +199,36 @@ public:
     // contains: Returns true if the key exists in the hash table, false otherwise.
     bool containsValue(const int& value) const;
 
+    // containsMany: found[i] tells whether values[i] is in the set. Buckets are prefetched
+    // a few values ahead of the search (see hashSet.cpp). Returns the number of values found.
+    size_t containsMany(const std::vector<int>& values, std::vector<bool>& found) const;
+
+    // parallelForEach: Calls visit(worker, value) for every value from up to 'threads'
+    // threads, each walking its own contiguous range of buckets (see HashMap::parallelForEach).
+    // The set must not be modified during the walk.
+    void parallelForEach(const std::function<void(size_t worker, int value)>& visit, size_t threads) const;
+
+    // Set algebra. Each operation walks the values of the smaller set where the result
+    // allows it, and looks them up in the other set in batches (containsMany). With
+    // threads > 1 the lookups are split across threads, which pays off from about a
+    // million values; the set is still modified by the calling thread only.
+
+    // unionWith: Adds every value of 'other'
+    void unionWith(const HashSet& other, size_t threads = 1);
+
+    // intersectWith: Keeps only the values that are also in 'other'
+    void intersectWith(const HashSet& other, size_t threads = 1);
+
+    // differenceWith: Removes every value that is in 'other'
+    void differenceWith(const HashSet& other, size_t threads = 1);
+
+    // Size-only variants: the size of the union, intersection or difference, without building it
+    size_t unionSize(const HashSet& other, size_t threads = 1) const;
+
+    size_t intersectionSize(const HashSet& other, size_t threads = 1) const;
+
+    size_t differenceSize(const HashSet& other, size_t threads = 1) const;
+
     // clear: Removes all key-value pairs from the hash table
     void clear();
 
@@ -53,6 +238,46 @@ public:
     //getTableSize: Return the hash set table size 
     size_t getTableSize() const;
 
+    // setIncrementalResize: When enabled, a resize allocates the new table and then
+    // each insert/remove migrates a few old buckets, instead of rehashing every value
+    // at once. Disabling it finishes any migration in progress.
+    void setIncrementalResize(bool enabled);
+
+    // isRehashing: Returns true while values remain in the old table
+    bool isRehashing() const;
+
+    // reserve: Grows the table once so that 'count' values fit without further resizes
+    void reserve(size_t count);
+
+    // rehash: Resizes the table to at least 'buckets' buckets, and at least enough
+    // for the current values under the maximum load factor (it may shrink the table)
+    void rehash(size_t buckets);
+
+    // setLoadFactors: Sets the grow and shrink thresholds. Throws std::invalid_argument
+    // unless 0 <= minLoad, 2 * minLoad < maxLoad and maxLoad > 0.
+    void setLoadFactors(double maxLoad, double minLoad);
+
+    double getMaxLoadFactor() const;
+
+    double getMinLoadFactor() const;
+
+    // setAutoShrink: When disabled, remove never shrinks the table (rehash still can)
+    void setAutoShrink(bool enabled);
+
+    // saveSnapshot: Writes the buckets to 'path' in the snapshot format of hashSnapshot.h.
+    // Values still in the old table of a resize are written to their new bucket.
+    // Throws std::runtime_error if the file cannot be written.
+    void saveSnapshot(const std::string& path) const;
+
+    // loadSnapshot: Replaces the contents with a saved set, bucket by bucket, without
+    // hashing a value. Throws std::runtime_error, leaving the set unchanged, if the file
+    // is missing, damaged or not a HashSet snapshot.
+    void loadSnapshot(const std::string& path);
+
+    // getStats: Bucket length histogram, probe lengths, collision rate and resize
+    // history (see hashTableStats.h)
+    HashTableStats getStats() const;
+
     // print: Prints the contents of the hash table for debugging purposes.
     void print() const;
 };
@@ -0,0 +1,264 @@
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint32_t, uint64_t
+#include <cstdio>    // For std::rename, std::remove
+#include <cstring>   // For std::memcpy, std::memcmp
+#include <fstream>
+#include <iterator>  // For std::istreambuf_iterator
+#include <stdexcept>
+#include <string>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>      // For open
+#include <sys/mman.h>   // For mmap, munmap
+#include <sys/stat.h>   // For fstat
+#include <unistd.h>     // For close
+#define SNAPSHOT_USE_MMAP 1
+#endif
+#include "hashSnapshot.h"
+
+template class HashMapSnapshotView<int, std::string>;
+template class HashMapSnapshotView<std::string, int>;
+template class HashMapSnapshotView<std::string, std::string>;
+
+static const char SNAPSHOT_MAGIC[8] = {'H', 'A', 'S', 'H', 'S', 'N', 'A', 'P'};
+
+const size_t SnapshotWriter::CHUNK_BYTES;
+
+// The header goes first as a placeholder; finish() rewrites it with the checksum
+SnapshotWriter::SnapshotWriter(const std::string& path, const SnapshotHeader& header)
+    : path(path), tempPath(path + ".tmp"), header(header), finished(false) {
+    std::memcpy(this->header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    this->header.version = SNAPSHOT_VERSION;
+    this->header.byteOrder = SNAPSHOT_BYTE_ORDER;
+    this->header.reserved = 0;
+    this->header.payloadBytes = 0;
+    this->header.checksum = 0;
+    this->chunk.reserve(CHUNK_BYTES);
+
+    this->out.open(this->tempPath, std::ios::binary | std::ios::trunc);
+    this->out.write(reinterpret_cast<const char*>(&this->header), sizeof(this->header));
+    if (!this->out) {
+        throw std::runtime_error("Cannot write snapshot: " + this->tempPath);
+    }
+};
+
+// An unfinished snapshot (an exception while saving) is deleted
+SnapshotWriter::~SnapshotWriter() {
+    if (!this->finished) {
+        this->out.close();
+        std::remove(this->tempPath.c_str());
+    }
+};
+
+void SnapshotWriter::flushChunk() {
+    this->header.checksum = hashing::hashBytes(this->chunk.data(), this->chunk.size(), this->header.checksum);
+    this->out.write(this->chunk.data(), this->chunk.size());
+    if (!this->out) {
+        throw std::runtime_error("Cannot write snapshot: " + this->tempPath);
+    }
+    this->header.payloadBytes += this->chunk.size();
+    this->chunk.clear();
+};
+
+// Bytes are checksummed in chunks of exactly CHUNK_BYTES, whatever the sizes appended
+void SnapshotWriter::append(const void* data, size_t length) {
+    const char* bytes = static_cast<const char*>(data);
+    while (length > 0) {
+        size_t room = CHUNK_BYTES - this->chunk.size();
+        size_t taken = length < room ? length : room;
+        this->chunk.insert(this->chunk.end(), bytes, bytes + taken);
+        bytes += taken;
+        length -= taken;
+        if (this->chunk.size() == CHUNK_BYTES) {
+            this->flushChunk();
+        }
+    }
+};
+
+void SnapshotWriter::finish() {
+    if (!this->chunk.empty()) {
+        this->flushChunk();
+    }
+    this->out.seekp(0);
+    this->out.write(reinterpret_cast<const char*>(&this->header), sizeof(this->header));
+    this->out.close();
+    if (!this->out || std::rename(this->tempPath.c_str(), this->path.c_str()) != 0) {
+        throw std::runtime_error("Cannot write snapshot: " + this->path);
+    }
+    this->finished = true;
+};
+
+uint64_t SnapshotWriter::checksumOf(const char* data, size_t length) {
+    uint64_t checksum = 0;
+    for (size_t offset = 0; offset < length; offset += CHUNK_BYTES) {
+        size_t piece = length - offset < CHUNK_BYTES ? length - offset : CHUNK_BYTES;
+        checksum = hashing::hashBytes(data + offset, piece, checksum);
+    }
+    return checksum;
+};
+
+// Constructor: Maps the whole file, then checks that the header describes a file of
+// exactly this size
+SnapshotFile::SnapshotFile(const std::string& path) : data(nullptr), length(0), mapped(false) {
+#ifdef SNAPSHOT_USE_MMAP
+    int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        throw std::runtime_error("Cannot open snapshot: " + path);
+    }
+    struct stat status;
+    if (::fstat(descriptor, &status) != 0) {
+        ::close(descriptor);
+        throw std::runtime_error("Cannot open snapshot: " + path);
+    }
+    this->length = static_cast<size_t>(status.st_size);
+    if (this->length > 0) {
+        void* address = ::mmap(nullptr, this->length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (address != MAP_FAILED) {
+            this->data = static_cast<const char*>(address);
+            this->mapped = true;
+        }
+    }
+    ::close(descriptor);
+#endif
+    if (!this->mapped) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error("Cannot open snapshot: " + path);
+        }
+        this->buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        this->data = this->buffer.data();
+        this->length = this->buffer.size();
+    }
+
+    if (this->length < sizeof(SnapshotHeader)) {
+        this->unmap();
+        throw std::runtime_error("Not a snapshot file: " + path);
+    }
+    std::memcpy(&this->header, this->data, sizeof(SnapshotHeader));
+    const char* problem = nullptr;
+    if (std::memcmp(this->header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) {
+        problem = "Not a snapshot file: ";
+    } else if (this->header.byteOrder != SNAPSHOT_BYTE_ORDER) {
+        problem = "Snapshot saved with another byte order: ";
+    } else if (this->header.version != SNAPSHOT_VERSION) {
+        problem = "Unsupported snapshot version: ";
+    } else if (this->header.payloadBytes != this->length - sizeof(SnapshotHeader)
+               || this->header.tableSize == 0
+               || this->header.tableSize >= this->header.payloadBytes / sizeof(uint64_t)
+               || this->bucketBegin(this->header.tableSize) != this->header.payloadBytes
+                      - (this->header.tableSize + 1) * sizeof(uint64_t)) {
+        problem = "Truncated or damaged snapshot: ";
+    }
+    if (problem != nullptr) {
+        this->unmap();
+        throw std::runtime_error(problem + path);
+    }
+};
+
+void SnapshotFile::unmap() {
+#ifdef SNAPSHOT_USE_MMAP
+    if (this->mapped) {
+        ::munmap(const_cast<char*>(this->data), this->length);
+        this->mapped = false;
+    }
+#endif
+};
+
+SnapshotFile::~SnapshotFile() {
+    this->unmap();
+};
+
+const SnapshotHeader& SnapshotFile::getHeader() const {
+    return this->header;
+};
+
+void SnapshotFile::expect(uint32_t kind, uint32_t keyType, uint32_t valueType, uint64_t hasherCheck) const {
+    if (this->header.kind != kind || this->header.keyType != keyType || this->header.valueType != valueType) {
+        throw std::runtime_error("Snapshot holds a different kind of table");
+    }
+    if (this->header.hasherCheck != hasherCheck) {
+        throw std::runtime_error("Snapshot was saved with a different hash function");
+    }
+};
+
+void SnapshotFile::verifyChecksum() const {
+    if (SnapshotWriter::checksumOf(this->data + sizeof(SnapshotHeader), this->header.payloadBytes)
+        != this->header.checksum) {
+        throw std::runtime_error("Snapshot checksum mismatch");
+    }
+};
+
+uint64_t SnapshotFile::bucketBegin(size_t bucket) const {
+    uint64_t offset;
+    std::memcpy(&offset, this->data + sizeof(SnapshotHeader) + bucket * sizeof(uint64_t), sizeof(offset));
+    return offset;
+};
+
+const char* SnapshotFile::records() const {
+    return this->data + sizeof(SnapshotHeader) + (this->header.tableSize + 1) * sizeof(uint64_t);
+};
+
+const char* SnapshotFile::recordsEnd() const {
+    return this->records() + this->bucketBegin(this->header.tableSize);
+};
+
+// Constructor: checks the file against the types and hasher of this view
+template<typename KeyType, typename ValueType, typename Hasher>
+HashMapSnapshotView<KeyType, ValueType, Hasher>::HashMapSnapshotView(const std::string& path, bool verifyChecksum,
+                                                                    const Hasher& hasher)
+    : file(path), hasher(hasher) {
+    this->file.expect(SNAPSHOT_MAP, SnapshotCodec<KeyType>::TYPE_ID, SnapshotCodec<ValueType>::TYPE_ID,
+                      this->hasher(SnapshotCodec<KeyType>::sampleKey()));
+    this->tableSize = static_cast<size_t>(this->file.getHeader().tableSize);
+    if ((this->tableSize & (this->tableSize - 1)) != 0) {
+        throw std::runtime_error("Truncated or damaged snapshot: " + path);
+    }
+    if (verifyChecksum) {
+        this->file.verifyChecksum();
+    }
+}
+
+// Scans the records of the key's bucket, decoding each key in place (no copies)
+template<typename KeyType, typename ValueType, typename Hasher>
+bool HashMapSnapshotView<KeyType, ValueType, Hasher>::tryGet(const LookupKey& key, ValueView& value) const {
+    size_t bucket = static_cast<size_t>(this->hasher(key)) & (this->tableSize - 1);
+    uint64_t begin = this->file.bucketBegin(bucket), end = this->file.bucketBegin(bucket + 1);
+    const char* recordsEnd = this->file.recordsEnd();
+    if (begin > end || end > static_cast<uint64_t>(recordsEnd - this->file.records())) {
+        throw std::runtime_error("Truncated or damaged snapshot");
+    }
+    const char* record = this->file.records() + begin;
+    const char* bucketEnd = this->file.records() + end;
+    while (record < bucketEnd) {
+        typename SnapshotCodec<KeyType>::View storedKey;
+        ValueView storedValue;
+        record = SnapshotCodec<KeyType>::decode(record, bucketEnd, storedKey);
+        if (record != nullptr) {
+            record = SnapshotCodec<ValueType>::decode(record, bucketEnd, storedValue);
+        }
+        if (record == nullptr) {
+            throw std::runtime_error("Truncated or damaged snapshot");
+        }
+        if (storedKey == key) {
+            value = storedValue;
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+bool HashMapSnapshotView<KeyType, ValueType, Hasher>::contains(const LookupKey& key) const {
+    ValueView value;
+    return this->tryGet(key, value);
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t HashMapSnapshotView<KeyType, ValueType, Hasher>::getSize() const {
+    return static_cast<size_t>(this->file.getHeader().numElements);
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t HashMapSnapshotView<KeyType, ValueType, Hasher>::getTableSize() const {
+    return this->tableSize;
+}
@@ -0,0 +1,226 @@
+#pragma once
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint32_t, uint64_t
+#include <cstring>   // For std::memcpy
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "hashFunctions.h"
+
+// Snapshot files: the bucket layout of a HashMap or HashSet written to disk as is, so
+// a process can restore the table without hashing or inserting a single key.
+//
+//   header      SnapshotHeader (72 bytes): magic, version, what was saved, checksum
+//   offsets     tableSize + 1 uint64 values; bucket b holds the records in
+//               [offsets[b], offsets[b + 1]) of the record area (CSR layout)
+//   records     the entries, bucket by bucket, each key followed by its value
+//               (see SnapshotCodec for the encoding of each type)
+//
+// Numbers are stored in the byte order of the machine that saved the file; a file
+// from a machine of the other byte order is rejected. The checksum is hashBytes over
+// the offsets and records, chained over 64 KB chunks so it can be computed while writing.
+
+const uint32_t SNAPSHOT_VERSION = 1;
+const uint32_t SNAPSHOT_BYTE_ORDER = 0x01020304;
+const uint32_t SNAPSHOT_MAP = 1;
+const uint32_t SNAPSHOT_SET = 2;
+const uint32_t SNAPSHOT_NO_VALUE = 0;   // Value type of a set
+
+struct SnapshotHeader {
+    char magic[8];          // "HASHSNAP"
+    uint32_t version;
+    uint32_t byteOrder;     // SNAPSHOT_BYTE_ORDER as written by the saving machine
+    uint32_t kind;          // SNAPSHOT_MAP or SNAPSHOT_SET
+    uint32_t keyType;       // SnapshotCodec<KeyType>::TYPE_ID
+    uint32_t valueType;     // SnapshotCodec<ValueType>::TYPE_ID, or SNAPSHOT_NO_VALUE
+    uint32_t reserved;
+    uint64_t tableSize;     // Number of buckets
+    uint64_t numElements;
+    uint64_t hasherCheck;   // Hash of a fixed sample key: the layout is only valid for the same hasher
+    uint64_t payloadBytes;  // Bytes after the header (offsets and records)
+    uint64_t checksum;
+};
+
+static_assert(sizeof(SnapshotHeader) == 72, "SnapshotHeader must have no padding");
+
+// SnapshotCodec: how a key or value type is stored in a record. Fixed-width integers
+// are copied as they are; strings are a uint32 length followed by the characters.
+// View is what a lookup in a mapped file returns: the value itself, or a
+// std::string_view into the file for strings. decode returns nullptr if the record
+// would run past 'end' (a damaged file).
+template<typename T>
+struct SnapshotCodec;
+
+template<typename T, uint32_t Id>
+struct FixedWidthSnapshotCodec {
+    using View = T;
+    static const uint32_t TYPE_ID = Id;
+
+    static T sampleKey() {
+        return static_cast<T>(0x5EED);
+    }
+
+    static size_t encodedSize(const T&) {
+        return sizeof(T);
+    }
+
+    static char* encode(const T& value, char* out) {
+        std::memcpy(out, &value, sizeof(T));
+        return out + sizeof(T);
+    }
+
+    static const char* decode(const char* in, const char* end, View& value) {
+        if (static_cast<size_t>(end - in) < sizeof(T)) {
+            return nullptr;
+        }
+        std::memcpy(&value, in, sizeof(T));
+        return in + sizeof(T);
+    }
+};
+
+template<>
+struct SnapshotCodec<int> : FixedWidthSnapshotCodec<int, 1> { };
+
+template<>
+struct SnapshotCodec<uint32_t> : FixedWidthSnapshotCodec<uint32_t, 2> { };
+
+template<>
+struct SnapshotCodec<uint64_t> : FixedWidthSnapshotCodec<uint64_t, 3> { };
+
+template<>
+struct SnapshotCodec<std::string> {
+    using View = std::string_view;
+    static const uint32_t TYPE_ID = 4;
+
+    static std::string sampleKey() {
+        return "snapshot-hasher-check";
+    }
+
+    static size_t encodedSize(const std::string& value) {
+        return sizeof(uint32_t) + value.size();
+    }
+
+    static char* encode(const std::string& value, char* out) {
+        uint32_t length = static_cast<uint32_t>(value.size());
+        std::memcpy(out, &length, sizeof(length));
+        std::memcpy(out + sizeof(length), value.data(), value.size());
+        return out + sizeof(length) + value.size();
+    }
+
+    static const char* decode(const char* in, const char* end, View& value) {
+        uint32_t length;
+        if (static_cast<size_t>(end - in) < sizeof(length)) {
+            return nullptr;
+        }
+        std::memcpy(&length, in, sizeof(length));
+        in += sizeof(length);
+        if (static_cast<size_t>(end - in) < length) {
+            return nullptr;
+        }
+        value = View(in, length);
+        return in + length;
+    }
+};
+
+// Writes a snapshot to 'path + ".tmp"' and renames it over 'path' in finish(), so a
+// crash while saving never leaves a truncated snapshot behind. Throws
+// std::runtime_error if the file cannot be written.
+class SnapshotWriter {
+private:
+    static const size_t CHUNK_BYTES = 1 << 16;
+
+    std::string path;
+    std::string tempPath;
+    std::ofstream out;
+    SnapshotHeader header;
+    std::vector<char> chunk;   // Payload bytes not yet checksummed and written
+    bool finished;
+
+    void flushChunk();
+
+public:
+    // Constructor: fills in magic, version and byte order; the caller sets the rest
+    // of 'header' (payloadBytes and checksum are computed here)
+    SnapshotWriter(const std::string& path, const SnapshotHeader& header);
+
+    ~SnapshotWriter();
+
+    SnapshotWriter(const SnapshotWriter&) = delete;
+    SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+    void append(const void* data, size_t length);
+
+    // finish: Writes the final header and moves the file into place
+    void finish();
+
+    // checksumOf: The checksum of a whole payload, as finish() computes it piece by piece
+    static uint64_t checksumOf(const char* data, size_t length);
+};
+
+// A snapshot file mapped read-only into memory (read into a buffer where mmap is not
+// available). The constructor checks the header and the size of the file; the
+// contents are only trusted after verifyChecksum(). Throws std::runtime_error.
+class SnapshotFile {
+private:
+    const char* data;
+    size_t length;
+    bool mapped;
+    std::vector<char> buffer;
+    SnapshotHeader header;
+
+    void unmap();
+
+public:
+    explicit SnapshotFile(const std::string& path);
+
+    ~SnapshotFile();
+
+    SnapshotFile(const SnapshotFile&) = delete;
+    SnapshotFile& operator=(const SnapshotFile&) = delete;
+
+    const SnapshotHeader& getHeader() const;
+
+    // expect: Throws unless the file holds this kind of table with these types and hasher
+    void expect(uint32_t kind, uint32_t keyType, uint32_t valueType, uint64_t hasherCheck) const;
+
+    void verifyChecksum() const;
+
+    // bucketBegin: Offset of the first record of the bucket; bucketBegin(tableSize) is
+    // the size of the record area
+    uint64_t bucketBegin(size_t bucket) const;
+
+    const char* records() const;
+
+    const char* recordsEnd() const;
+};
+
+// Read-only HashMap served straight from a mapped snapshot: opening it costs one
+// mmap (plus one pass for the checksum, if verified), and pages are read from disk
+// only as lookups touch them. String views returned by tryGet point into the file
+// and stay valid as long as the view.
+template<typename KeyType, typename ValueType, typename Hasher = DefaultHash<KeyType>>
+class HashMapSnapshotView {
+public:
+    using LookupKey = typename HasherLookupType<KeyType, Hasher>::type;
+    using ValueView = typename SnapshotCodec<ValueType>::View;
+
+private:
+    SnapshotFile file;
+    Hasher hasher;
+    size_t tableSize;
+
+public:
+    // Constructor: throws std::runtime_error if the file is not a snapshot of a
+    // HashMap<KeyType, ValueType, Hasher> (or, when verified, fails its checksum)
+    explicit HashMapSnapshotView(const std::string& path, bool verifyChecksum = true, const Hasher& hasher = Hasher());
+
+    // tryGet: Sets 'value' and returns true if the key is present
+    bool tryGet(const LookupKey& key, ValueView& value) const;
+
+    bool contains(const LookupKey& key) const;
+
+    size_t getSize() const;
+
+    size_t getTableSize() const;
+};
@@ -0,0 +1,84 @@
+#include <chrono>
+#include <cmath>     // For std::exp
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint64_t
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "hashTableStats.h"
+
+ResizeCounters::ResizeCounters() : grows(0), shrinks(0), rehashNanoseconds(0) { };
+
+void ResizeCounters::countResize(size_t oldSize, size_t newSize) {
+    if (newSize > oldSize) {
+        this->grows++;
+    } else if (newSize < oldSize) {
+        this->shrinks++;
+    }
+};
+
+RehashTimer::RehashTimer(ResizeCounters& counters) : counters(counters), start(std::chrono::steady_clock::now()) { };
+
+RehashTimer::~RehashTimer() {
+    std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - this->start;
+    this->counters.rehashNanoseconds += static_cast<uint64_t>(elapsed.count());
+};
+
+HashTableStats::HashTableStats()
+    : elements(0), buckets(0), loadFactor(0), openAddressing(false), averageProbeLength(0), maxProbeLength(0),
+      collisionRate(0), expectedCollisionRate(0), grows(0), shrinks(0), rehashMilliseconds(0), probeTotal(0) { };
+
+// A lookup of the k-th entry of a chain visits k entries: a chain of n costs 1 + ... + n
+void HashTableStats::addBucket(size_t length) {
+    if (this->histogram.size() <= length) {
+        this->histogram.resize(length + 1, 0);
+    }
+    this->histogram[length]++;
+    this->probeTotal += static_cast<uint64_t>(length) * (length + 1) / 2;
+    if (length > this->maxProbeLength) {
+        this->maxProbeLength = length;
+    }
+};
+
+// An entry 'displacement' slots past its home is found after visiting displacement + 1 slots
+void HashTableStats::addEntry(size_t displacement) {
+    this->openAddressing = true;
+    if (this->histogram.size() <= displacement) {
+        this->histogram.resize(displacement + 1, 0);
+    }
+    this->histogram[displacement]++;
+    this->probeTotal += displacement + 1;
+    if (displacement + 1 > this->maxProbeLength) {
+        this->maxProbeLength = displacement + 1;
+    }
+};
+
+void HashTableStats::finish(size_t elements, size_t buckets, size_t homeBuckets, const ResizeCounters& counters) {
+    this->elements = elements;
+    this->buckets = buckets;
+    this->loadFactor = buckets == 0 ? 0 : static_cast<double>(elements) / buckets;
+    if (elements > 0) {
+        this->averageProbeLength = static_cast<double>(this->probeTotal) / elements;
+        this->collisionRate = 1 - static_cast<double>(homeBuckets) / elements;
+        this->expectedCollisionRate = 1 - (1 - std::exp(-this->loadFactor)) / this->loadFactor;
+    }
+    this->grows = counters.grows;
+    this->shrinks = counters.shrinks;
+    this->rehashMilliseconds = counters.rehashNanoseconds / 1e6;
+};
+
+// print: One line per statistic, then the non-zero rows of the histogram
+void HashTableStats::print(std::ostream& out) const {
+    out << "Elements: " << this->elements << ", " << (this->openAddressing ? "slots: " : "buckets: ")
+        << this->buckets << ", load factor: " << this->loadFactor << std::endl;
+    out << "Probe length: average " << this->averageProbeLength << ", max " << this->maxProbeLength << std::endl;
+    out << "Collision rate: " << this->collisionRate << " (uniform hash: " << this->expectedCollisionRate << ")" << std::endl;
+    out << "Resizes: " << this->grows << " up, " << this->shrinks << " down, "
+        << this->rehashMilliseconds << " ms rehashing" << std::endl;
+    out << (this->openAddressing ? "Entries by displacement:" : "Buckets by length:") << std::endl;
+    for (size_t i = 0; i < this->histogram.size(); i++) {
+        if (this->histogram[i] > 0) {
+            out << std::setw(8) << i << ": " << this->histogram[i] << std::endl;
+        }
+    }
+};
@@ -0,0 +1,99 @@
+#pragma once
+#include <chrono>
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint64_t
+#include <iostream>
+#include <vector>
+
+// Resize history kept by a table: how often it grew and shrank, and the total time
+// spent allocating new tables and moving entries into them
+struct ResizeCounters {
+    size_t grows;
+    size_t shrinks;
+    uint64_t rehashNanoseconds;
+
+    ResizeCounters();
+
+    // Counts one resize from 'oldSize' to 'newSize' buckets
+    void countResize(size_t oldSize, size_t newSize);
+};
+
+// Adds the time from its construction to its destruction to the counters' rehash time
+class RehashTimer {
+private:
+    ResizeCounters& counters;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    explicit RehashTimer(ResizeCounters& counters);
+
+    ~RehashTimer();
+};
+
+// HashTableStats: a summary of a table's layout and resize history, meant to be logged
+// from a production-size table (print() writes a dozen lines, not one per bucket).
+//
+// Chained tables (HashMap, HashSet) report the length of every bucket; open-addressing
+// tables (RobinHoodHashMap) the probe distance of every entry. finish() then derives
+// the averages, and compares the collision rate with what a perfectly uniform hash
+// would give at the same load: a hash function that is weak for the keys shows up
+// as an observed rate well above the expected one.
+struct HashTableStats {
+    size_t elements;
+    size_t buckets;                // Buckets of a chained table, slots of an open-addressing one
+    double loadFactor;
+
+    // Chained tables: histogram[k] is the number of buckets holding k entries.
+    // Open addressing: histogram[d] is the number of entries d slots past their home slot.
+    std::vector<size_t> histogram;
+    bool openAddressing;
+
+    double averageProbeLength;     // Entries (or slots) a successful lookup visits, on average
+    size_t maxProbeLength;         // ... and at most
+
+    // Fraction of the entries whose home bucket already holds an earlier entry:
+    // 1 - (home buckets in use) / elements
+    double collisionRate;
+    double expectedCollisionRate;  // The same for a uniform random hash: 1 - (1 - e^-load) / load
+
+    size_t grows;
+    size_t shrinks;
+    double rehashMilliseconds;
+
+    HashTableStats();
+
+    // addBucket: Records a bucket of a chained table holding 'length' entries
+    void addBucket(size_t length);
+
+    // addEntry: Records an entry of an open-addressing table 'displacement' slots past its home
+    void addEntry(size_t displacement);
+
+    // finish: Derives the averages and rates. 'homeBuckets' is the number of distinct
+    // home buckets (or slots) of the entries.
+    void finish(size_t elements, size_t buckets, size_t homeBuckets, const ResizeCounters& counters);
+
+    void print(std::ostream& out = std::cout) const;
+
+private:
+    uint64_t probeTotal;           // Sum of the probe lengths of all entries
+};
+
+// bucketCollisionRate: The collision rate (as in HashTableStats) of 'keys' spread over
+// 'buckets' buckets by the low bits of 'hasher', for comparing hash functions on real
+// keys without building a table. 'buckets' must be a power of two.
+template<typename KeyType, typename Hasher>
+double bucketCollisionRate(const std::vector<KeyType>& keys, size_t buckets, const Hasher& hasher) {
+    if (keys.empty()) {
+        return 0;
+    }
+    std::vector<bool> used(buckets, false);
+    size_t homeBuckets = 0;
+    for (const KeyType& key : keys) {
+        size_t bucket = static_cast<size_t>(hasher(key)) & (buckets - 1);
+        if (!used[bucket]) {
+            used[bucket] = true;
+            homeBuckets++;
+        }
+    }
+    return 1 - static_cast<double>(homeBuckets) / keys.size();
+}
@@ -0,0 +1,287 @@
+#include <cstddef>    // For size_t
+#include <cstdint>    // For uint64_t, uintptr_t
+#include <atomic>
+#include <iostream>
+#include "../lists/epochReclamation.h"
+#include "hashFunctions.h"
+#include "lockFreeHashSet.h"
+
+// Helpers for the marked pointers stored in SplitOrderNode::next
+static inline bool isMarked(uintptr_t link) {
+    return (link & 1) != 0;
+}
+
+static inline SplitOrderNode* getNode(uintptr_t link) {
+    return reinterpret_cast<SplitOrderNode*>(link & ~static_cast<uintptr_t>(1));
+}
+
+static inline uintptr_t toLink(SplitOrderNode* node) {
+    return reinterpret_cast<uintptr_t>(node);
+}
+
+// Deleter handed to the epoch reclaimer
+static void deleteSplitOrderNode(void* node) {
+    delete static_cast<SplitOrderNode*>(node);
+}
+
+// Reverses the 64 bits of 'bits' (swaps halves, then quarters, and so on)
+static inline uint64_t reverseBits(uint64_t bits) {
+    bits = ((bits >> 1) & 0x5555555555555555ULL) | ((bits & 0x5555555555555555ULL) << 1);
+    bits = ((bits >> 2) & 0x3333333333333333ULL) | ((bits & 0x3333333333333333ULL) << 2);
+    bits = ((bits >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((bits & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    bits = ((bits >> 8) & 0x00FF00FF00FF00FFULL) | ((bits & 0x00FF00FF00FF00FFULL) << 8);
+    bits = ((bits >> 16) & 0x0000FFFF0000FFFFULL) | ((bits & 0x0000FFFF0000FFFFULL) << 16);
+    return (bits >> 32) | (bits << 32);
+}
+
+// Sort key of a value: the top bit is set before reversing, so value keys are odd and
+// follow the (even) dummy key of the bucket given by their low hash bits
+static inline uint64_t valueSortKey(uint64_t hash) {
+    return reverseBits(hash | (1ULL << 63));
+}
+
+static inline uint64_t dummySortKey(size_t bucket) {
+    return reverseBits(static_cast<uint64_t>(bucket));
+}
+
+// Index of the highest set bit (bucket must not be 0)
+static inline size_t highestBit(size_t bucket) {
+    size_t bit = 0;
+    while (bucket >>= 1) {
+        bit++;
+    }
+    return bit;
+}
+
+// Whether (sortKey, value) of 'node' comes at or after the searched key
+static inline bool notBefore(const SplitOrderNode* node, uint64_t sortKey, int value) {
+    return node->sortKey > sortKey || (node->sortKey == sortKey && node->value >= value);
+}
+
+SplitOrderNode::SplitOrderNode(uint64_t sortKey, int value) : sortKey(sortKey), value(value), next(0) { };
+
+// Constructor: Initializes an empty set with 2 buckets; bucket 0's dummy node is the head
+LockFreeHashSet::LockFreeHashSet() : head(new SplitOrderNode(0, 0)), bucketCount(2), size(0) {
+    for (size_t i = 0; i < MAX_SEGMENTS; i++) {
+        this->segments[i].store(nullptr, std::memory_order_relaxed);
+    }
+    this->bucketSlot(0).store(this->head, std::memory_order_relaxed);
+};
+
+// Destructor: Releases all nodes still linked
+LockFreeHashSet::~LockFreeHashSet() {
+    this->destroy();
+};
+
+// Finds the directory slot of 'bucket'. Segment k covers buckets [2^k, 2^(k+1)), segment 0
+// covers buckets 0 and 1. Racing threads allocate a segment once: the CAS loser frees its copy.
+std::atomic<SplitOrderNode*>& LockFreeHashSet::bucketSlot(size_t bucket) {
+    size_t segment = bucket < 2 ? 0 : highestBit(bucket);
+    size_t offset = bucket < 2 ? bucket : bucket - (static_cast<size_t>(1) << segment);
+
+    std::atomic<SplitOrderNode*>* slots = this->segments[segment].load(std::memory_order_acquire);
+    if (slots == nullptr) {
+        size_t length = segment == 0 ? 2 : static_cast<size_t>(1) << segment;
+        std::atomic<SplitOrderNode*>* fresh = new std::atomic<SplitOrderNode*>[length];
+        for (size_t i = 0; i < length; i++) {
+            fresh[i].store(nullptr, std::memory_order_relaxed);
+        }
+        if (this->segments[segment].compare_exchange_strong(slots, fresh, std::memory_order_acq_rel)) {
+            slots = fresh;
+        } else {
+            delete[] fresh;     // 'slots' now holds the winner's segment
+        }
+    }
+    return slots[offset];
+};
+
+// Returns the dummy node of 'bucket'. An uninitialised bucket is split from its parent
+// (the bucket index without its highest bit): its dummy node is inserted into the list
+// after the parent's dummy node. Every thread ends up with the same dummy node.
+SplitOrderNode* LockFreeHashSet::getBucket(size_t bucket) {
+    std::atomic<SplitOrderNode*>& slot = this->bucketSlot(bucket);
+    SplitOrderNode* dummy = slot.load(std::memory_order_acquire);
+    if (dummy != nullptr) {
+        return dummy;
+    }
+
+    size_t parent = bucket & ~(static_cast<size_t>(1) << highestBit(bucket));
+    SplitOrderNode* parentDummy = this->getBucket(parent);
+
+    SplitOrderNode* fresh = new SplitOrderNode(dummySortKey(bucket), 0);
+    dummy = this->listInsert(parentDummy, fresh);
+    if (dummy != fresh) {
+        delete fresh;           // Another thread linked the dummy node first
+    }
+    slot.store(dummy, std::memory_order_release);
+    return dummy;
+};
+
+// Michael's list search: whoever unlinks a marked node with a successful CAS retires it
+bool LockFreeHashSet::find(SplitOrderNode* start, uint64_t sortKey, int value,
+                           std::atomic<uintptr_t>*& prevLink, SplitOrderNode*& current) {
+    bool retry = true;
+    while (retry) {
+        retry = false;
+        prevLink = &start->next;
+        current = getNode(prevLink->load(std::memory_order_acquire));
+
+        while (current != nullptr) {
+            uintptr_t successor = current->next.load(std::memory_order_acquire);
+            if (isMarked(successor)) {
+                uintptr_t expected = toLink(current);
+                if (!prevLink->compare_exchange_strong(expected, successor & ~static_cast<uintptr_t>(1),
+                                                       std::memory_order_acq_rel)) {
+                    retry = true;   // The predecessor changed or was removed itself
+                    break;
+                }
+                EpochReclaimer::instance().retire(current, deleteSplitOrderNode);
+                current = getNode(successor);
+                continue;
+            }
+            if (notBefore(current, sortKey, value)) {
+                return current->sortKey == sortKey && current->value == value;
+            }
+            prevLink = &current->next;
+            current = getNode(successor);
+        }
+    }
+    return false;
+};
+
+// Links 'node' in sorted position after 'start', unless its key is already there
+SplitOrderNode* LockFreeHashSet::listInsert(SplitOrderNode* start, SplitOrderNode* node) {
+    std::atomic<uintptr_t>* prevLink;
+    SplitOrderNode* current;
+    while (true) {
+        if (this->find(start, node->sortKey, node->value, prevLink, current)) {
+            return current;
+        }
+        node->next.store(toLink(current), std::memory_order_relaxed);
+        uintptr_t expected = toLink(current);
+        if (prevLink->compare_exchange_strong(expected, toLink(node), std::memory_order_acq_rel)) {
+            return node;
+        }
+    }
+};
+
+// insert: Adds the value; doubles the bucket count when the average bucket gets too long
+bool LockFreeHashSet::insert(int value) {
+    EpochGuard guard;
+    uint64_t hash = IntHash()(value);
+    size_t buckets = this->bucketCount.load(std::memory_order_acquire);
+    SplitOrderNode* start = this->getBucket(static_cast<size_t>(hash) & (buckets - 1));
+
+    SplitOrderNode* node = new SplitOrderNode(valueSortKey(hash), value);
+    if (this->listInsert(start, node) != node) {
+        delete node;            // Never published, so it can be freed right away
+        return false;
+    }
+
+    size_t newSize = this->size.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (newSize > buckets * MAX_LOAD && buckets < (static_cast<size_t>(1) << (MAX_SEGMENTS - 1))) {
+        this->bucketCount.compare_exchange_strong(buckets, buckets * 2, std::memory_order_acq_rel);
+    }
+    return true;
+};
+
+// remove: Marks the node (the linearization point), then tries to unlink it
+bool LockFreeHashSet::remove(int value) {
+    EpochGuard guard;
+    uint64_t hash = IntHash()(value);
+    uint64_t sortKey = valueSortKey(hash);
+    size_t buckets = this->bucketCount.load(std::memory_order_acquire);
+    SplitOrderNode* start = this->getBucket(static_cast<size_t>(hash) & (buckets - 1));
+
+    std::atomic<uintptr_t>* prevLink;
+    SplitOrderNode* current;
+    while (true) {
+        if (!this->find(start, sortKey, value, prevLink, current)) {
+            return false;
+        }
+        uintptr_t successor = current->next.load(std::memory_order_acquire);
+        if (isMarked(successor)) {
+            continue;           // Another remover got there first; find will clean up
+        }
+        if (!current->next.compare_exchange_strong(successor, successor | 1, std::memory_order_acq_rel)) {
+            continue;
+        }
+
+        uintptr_t expected = toLink(current);
+        if (prevLink->compare_exchange_strong(expected, successor, std::memory_order_acq_rel)) {
+            EpochReclaimer::instance().retire(current, deleteSplitOrderNode);
+        } else {
+            this->find(start, sortKey, value, prevLink, current);   // Unlinks and retires it
+        }
+        this->size.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+};
+
+// containsValue: Walks the bucket without modifying links; marked nodes count as absent
+bool LockFreeHashSet::containsValue(int value) {
+    EpochGuard guard;
+    uint64_t hash = IntHash()(value);
+    uint64_t sortKey = valueSortKey(hash);
+    size_t buckets = this->bucketCount.load(std::memory_order_acquire);
+    SplitOrderNode* current = this->getBucket(static_cast<size_t>(hash) & (buckets - 1));
+
+    while (current != nullptr && !notBefore(current, sortKey, value)) {
+        current = getNode(current->next.load(std::memory_order_acquire));
+    }
+    return current != nullptr && current->sortKey == sortKey && current->value == value
+        && !isMarked(current->next.load(std::memory_order_acquire));
+};
+
+size_t LockFreeHashSet::getSize() const {
+    return this->size.load(std::memory_order_relaxed);
+};
+
+size_t LockFreeHashSet::getBucketCount() const {
+    return this->bucketCount.load(std::memory_order_relaxed);
+};
+
+bool LockFreeHashSet::isEmpty() const {
+    return this->getSize() == 0;
+};
+
+// Frees every node still linked (marked or not) and the bucket directory
+void LockFreeHashSet::destroy() {
+    SplitOrderNode* current = this->head;
+    while (current != nullptr) {
+        SplitOrderNode* next = getNode(current->next.load(std::memory_order_relaxed));
+        delete current;
+        current = next;
+    }
+    this->head = nullptr;
+    for (size_t i = 0; i < MAX_SEGMENTS; i++) {
+        delete[] this->segments[i].load(std::memory_order_relaxed);
+        this->segments[i].store(nullptr, std::memory_order_relaxed);
+    }
+};
+
+// clear: Removes every value and starts over with 2 buckets (not thread-safe)
+void LockFreeHashSet::clear() {
+    this->destroy();
+    this->head = new SplitOrderNode(0, 0);
+    this->bucketSlot(0).store(this->head, std::memory_order_relaxed);
+    this->bucketCount.store(2, std::memory_order_relaxed);
+    this->size.store(0, std::memory_order_relaxed);
+};
+
+// print: Prints the values in split order (not thread-safe)
+void LockFreeHashSet::print() const {
+    if (this->isEmpty()) {
+        std::cout << "Set is empty" << std::endl;
+        return;
+    }
+    SplitOrderNode* current = getNode(this->head->next.load(std::memory_order_relaxed));
+    while (current != nullptr) {
+        uintptr_t next = current->next.load(std::memory_order_relaxed);
+        if ((current->sortKey & 1) && !isMarked(next)) {
+            std::cout << current->value << " ";
+        }
+        current = getNode(next);
+    }
+    std::cout << std::endl;
+};
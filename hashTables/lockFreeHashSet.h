@@ -0,0 +1,82 @@
+#pragma once
+#include <cstddef>    // For size_t
+#include <cstdint>    // For uint64_t, uintptr_t
+#include <atomic>
+
+// Node of the split-ordered list. The lowest bit of 'next' is the deletion mark:
+// once set, the node is logically removed and its link is frozen.
+struct SplitOrderNode {
+    uint64_t sortKey;                 // Bit-reversed hash (odd) or bit-reversed bucket index (even, dummy node)
+    int value;                        // Stored value (0 in dummy nodes)
+    std::atomic<uintptr_t> next;      // Marked pointer to the next node
+
+    SplitOrderNode(uint64_t sortKey, int value);
+};
+
+// Lock-free set of ints (Shalev-Shavit split-ordered list).
+//
+// All values live in one lock-free linked list sorted by their bit-reversed hash.
+// A bucket is a pointer to a dummy node inside that list, so doubling the number of
+// buckets never moves a value: a new bucket is initialised lazily by inserting its
+// dummy node after the dummy node of its parent bucket. insert/remove/containsValue may
+// be called from any number of threads; unlinked nodes are freed through
+// EpochReclaimer. The destructor, clear() and print() must not run concurrently
+// with other operations. The bucket directory only grows.
+class LockFreeHashSet {
+private:
+    static const size_t MAX_SEGMENTS = 64;      // Segment k holds 2^k buckets (segment 0 holds 2)
+    static const size_t MAX_LOAD = 2;           // Average values per bucket before doubling the bucket count
+
+    SplitOrderNode* head;                       // Dummy node of bucket 0, start of the list
+    std::atomic<std::atomic<SplitOrderNode*>*> segments[MAX_SEGMENTS];   // Bucket directory, allocated lazily
+    std::atomic<size_t> bucketCount;            // Always a power of two
+    std::atomic<size_t> size;                   // Number of values (exact when quiescent)
+
+    // Slot of the directory holding the dummy node of 'bucket', allocating its segment if needed
+    std::atomic<SplitOrderNode*>& bucketSlot(size_t bucket);
+
+    // Dummy node of 'bucket', inserting it (and its parents) into the list if needed
+    SplitOrderNode* getBucket(size_t bucket);
+
+    // Positions 'prevLink'/'current' around (sortKey, value) in the list starting at 'start',
+    // unlinking marked nodes on the way. Returns true if 'current' holds exactly that key.
+    bool find(SplitOrderNode* start, uint64_t sortKey, int value,
+              std::atomic<uintptr_t>*& prevLink, SplitOrderNode*& current);
+
+    // Links 'node' after 'start'; returns the node already holding its key, or 'node'
+    SplitOrderNode* listInsert(SplitOrderNode* start, SplitOrderNode* node);
+
+    // Frees every node and segment (not thread-safe)
+    void destroy();
+
+public:
+    // Constructor: Initializes an empty set with 2 buckets
+    LockFreeHashSet();
+
+    // Destructor: Releases all nodes still linked
+    ~LockFreeHashSet();
+
+    LockFreeHashSet(const LockFreeHashSet&) = delete;
+    LockFreeHashSet& operator=(const LockFreeHashSet&) = delete;
+
+    // insert: Adds the value, returns false if it was already present
+    bool insert(int value);
+
+    // remove: Removes the value, returns false if it was not present
+    bool remove(int value);
+
+    // containsValue: Returns true if the value is in the set
+    bool containsValue(int value);
+
+    size_t getSize() const;
+
+    size_t getBucketCount() const;
+
+    bool isEmpty() const;
+
+    // clear: Removes every value (not thread-safe)
+    void clear();
+
+    // print: Prints the values in split order (not thread-safe)
+    void print() const;
+};
@@ -1,6 +1,21 @@
 #include <iostream>
+#include <cstdio>    // For std::remove
+#include <atomic>
+#include <thread>
+#include <vector>
 #include "hashSet.h"
 #include "hashMap.h"
+#include "robinHoodHashMap.h"
+#include "swissHashSet.h"
+#include "concurrentHashMap.h"
+#include "lockFreeHashSet.h"
+#include "blockedBloomFilter.h"
+#include "cuckooFilter.h"
+#include "cuckooHashMap.h"
+#include "stringArenaMap.h"
+#include "hashSnapshot.h"
+#include "staticHashMap.h"
+#include "concurrentCache.h"
 
 int main() {
     // Testing Hash Set:
@@ -96,6 +111,521 @@ int main() {
     myMap.clear();
     myMap.print();
     std::cout << "Final number of elements: " << myMap.getSize() << std::endl;
-    
+
+    // --------------------- Begin String-Keyed HashMap Tests ---------------------
+    std::cout << "\n\n--- Testing HashMap with string keys ---" << std::endl;
+
+    HashMap<std::string, int> wordCounts(8);   // Hashed with BytesHash via DefaultHash<std::string>
+    std::string words[] = {"apple", "banana", "cherry", "apple", "date", "banana", "apple"};
+    for (const std::string& word : words) {
+        (*wordCounts.tryEmplace(word, 0).first)++;   // One hash and one bucket walk per word
+    }
+    wordCounts.print();
+    std::cout << "Distinct words: " << wordCounts.getSize() << std::endl;
+    std::cout << "Count of apple: " << wordCounts.get("apple") << std::endl;
+
+    std::string sentence = "banana split";
+    const int* bananaCount = wordCounts.find(std::string_view(sentence).substr(0, 6));   // No std::string built
+    std::cout << "Count of banana (found by string_view): " << (bananaCount ? *bananaCount : 0) << std::endl;
+    std::cout << "Find fig: " << (wordCounts.find("fig") ? "Found" : "Not found") << std::endl;
+
+    std::pair<int*, bool> result = wordCounts.insertOrAssign("cherry", 10);
+    std::cout << "insertOrAssign cherry -> 10 (inserted? " << (result.second ? "Yes" : "No")
+              << "), now " << wordCounts.get("cherry") << std::endl;
+    std::cout << "Hash of \"apple\" as std::string and as C string match? "
+              << (BytesHash()(std::string("apple")) == BytesHash()("apple") ? "Yes" : "No") << std::endl;
+
+    // --------------------- Begin Batched Lookup Tests ---------------------
+    std::cout << "\n\n--- Testing batched lookups ---" << std::endl;
+
+    std::vector<std::string_view> batch = {"apple", "fig", "date", "kiwi", "cherry"};
+    std::vector<const int*> counts;
+    size_t hits = wordCounts.getMany(batch, counts);
+    for (size_t i = 0; i < batch.size(); i++) {
+        std::cout << batch[i] << ": " << (counts[i] ? std::to_string(*counts[i]) : "absent") << std::endl;
+    }
+    std::cout << "getMany found " << hits << " of " << batch.size() << " keys" << std::endl;
+
+    HashSet squares;
+    for (int i = 1; i <= 50; i++) {
+        squares.insert(i * i);
+    }
+    std::vector<int> candidates = {1, 2, 49, 50, 2500, 2501};
+    std::vector<bool> isSquare;
+    squares.containsMany(candidates, isSquare);
+    for (size_t i = 0; i < candidates.size(); i++) {
+        std::cout << candidates[i] << (isSquare[i] ? " is" : " is not") << " a square up to 2500" << std::endl;
+    }
+
+    // --------------------- Begin Incremental Resizing Tests ---------------------
+    std::cout << "\n\n--- Testing incremental resizing ---" << std::endl;
+
+    HashMap<int, std::string> incrementalMap(8);
+    incrementalMap.setIncrementalResize(true);
+    for (int i = 1; i <= 6; i++) {
+        incrementalMap.insert(i, "Number " + std::to_string(i));
+    }
+    std::cout << "After 6 inserts: " << incrementalMap.getTableSize() << " buckets, rehashing? "
+              << (incrementalMap.isRehashing() ? "Yes" : "No") << std::endl;
+
+    incrementalMap.insert(7, "Number 7");   // Crosses the maximum load factor: only allocates the new table
+    std::cout << "After inserting key 7: " << incrementalMap.getTableSize() << " buckets, rehashing? "
+              << (incrementalMap.isRehashing() ? "Yes" : "No") << std::endl;
+    incrementalMap.print();
+    std::cout << "Key 3 found during the migration? " << (incrementalMap.contains(3) ? "Yes, value: " + incrementalMap.get(3) : "No") << std::endl;
+
+    incrementalMap.insert(8, "Number 8");   // Each insert migrates a few old buckets
+    incrementalMap.insert(9, "Number 9");
+    std::cout << "After two more inserts, rehashing? " << (incrementalMap.isRehashing() ? "Yes" : "No") << std::endl;
+    std::cout << "Number of elements: " << incrementalMap.getSize() << std::endl;
+
+    HashSet incrementalSet(5);
+    incrementalSet.setIncrementalResize(true);
+    for (int i = 1; i <= 20; i++) {
+        incrementalSet.insert(i);
+    }
+    std::cout << "HashSet with incremental resizing: " << incrementalSet.getSize() << " values in "
+              << incrementalSet.getTableSize() << " buckets, value 13 found? "
+              << (incrementalSet.containsValue(13) ? "Yes" : "No") << std::endl;
+
+    // --------------------- Begin Resize Policy Tests ---------------------
+    std::cout << "\n\n--- Testing resize policy ---" << std::endl;
+
+    HashMap<int, std::string> reservedMap;
+    reservedMap.reserve(1000);
+    size_t reservedBuckets = reservedMap.getTableSize();
+    for (int i = 0; i < 1000; i++) {
+        reservedMap.insert(i, "Number " + std::to_string(i));
+    }
+    std::cout << "Buckets after reserve(1000): " << reservedBuckets
+              << ", after 1000 inserts: " << reservedMap.getTableSize() << std::endl;
+
+    reservedMap.setAutoShrink(false);
+    for (int i = 0; i < 900; i++) {
+        reservedMap.remove(i);
+    }
+    std::cout << "After removing 900 keys without auto shrink: " << reservedMap.getTableSize() << " buckets" << std::endl;
+    reservedMap.rehash(0);   // Shrinks to the smallest size the remaining 100 keys allow
+    std::cout << "After rehash(0): " << reservedMap.getTableSize() << " buckets, load factor "
+              << reservedMap.getLoadFactor() << std::endl;
+
+    try {
+        reservedMap.setLoadFactors(0.5, 0.3);   // Would shrink right back after growing
+    } catch (const std::invalid_argument& e) {
+        std::cout << "setLoadFactors(0.5, 0.3) rejected: " << e.what() << std::endl;
+    }
+    reservedMap.setLoadFactors(0.9, 0.2);
+    std::cout << "New load factors: max " << reservedMap.getMaxLoadFactor() << ", min "
+              << reservedMap.getMinLoadFactor() << std::endl;
+
+    HashSet reservedSet;
+    reservedSet.reserve(500);
+    std::cout << "HashSet buckets after reserve(500): " << reservedSet.getTableSize() << std::endl;
+
+    // --------------------- Begin ConcurrentHashMap Tests ---------------------
+    std::cout << "\n\n--- Testing ConcurrentHashMap ---" << std::endl;
+
+    ConcurrentHashMap<int, std::string> concurrentMap(8);
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; t++) {
+        writers.emplace_back([&concurrentMap, t]() {
+            for (int i = t * 250; i < (t + 1) * 250; i++) {
+                concurrentMap.insert(i, "Number " + std::to_string(i));
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    std::cout << "Elements after 4 threads inserted 250 keys each: " << concurrentMap.getSize()
+              << " in " << concurrentMap.getShardCount() << " shards" << std::endl;
+
+    std::cout << "Value of key 421: " << concurrentMap.get(421) << std::endl;
+    std::cout << "Insert key 421 again: " << (concurrentMap.insert(421, "Ignored") ? "inserted" : "already present") << std::endl;
+    std::cout << "Upsert key 421: " << (concurrentMap.upsert(421, "Four hundred twenty-one") ? "inserted" : "overwritten")
+              << ", value now: " << concurrentMap.get(421) << std::endl;
+    concurrentMap.remove(421);
+    std::string copy;
+    std::cout << "Key 421 after remove: " << (concurrentMap.tryGet(421, copy) ? copy : "not found") << std::endl;
+
+    concurrentMap.clear();
+    std::cout << "Elements after clear: " << concurrentMap.getSize() << std::endl;
+
+    // --------------------- Begin LockFreeHashSet Tests ---------------------
+    std::cout << "\n\n--- Testing LockFreeHashSet ---" << std::endl;
+
+    LockFreeHashSet lockFreeSet;
+    for (int i = 1; i <= 8; i++) {
+        lockFreeSet.insert(i * 3);
+    }
+    std::cout << "Values in split order: ";
+    lockFreeSet.print();
+    std::cout << "Insert 9 again: " << (lockFreeSet.insert(9) ? "inserted" : "rejected") << std::endl;   // Expected: rejected
+    std::cout << "Remove 9: " << (lockFreeSet.remove(9) ? "removed" : "not found") << std::endl;         // Expected: removed
+    std::cout << "Value 9 found? " << (lockFreeSet.containsValue(9) ? "Yes" : "No") << std::endl;         // Expected: No
+    lockFreeSet.clear();
+
+    // Stress test: every thread inserts its own range, removes the even values and
+    // checks what it can see, while the bucket directory grows underneath
+    const int stressThreads = 8;
+    const int valuesPerThread = 20000;
+    std::atomic<bool> stressPassed(true);
+    std::vector<std::thread> stressWorkers;
+    for (int t = 0; t < stressThreads; t++) {
+        stressWorkers.emplace_back([&lockFreeSet, &stressPassed, t, valuesPerThread]() {
+            int first = t * valuesPerThread;
+            for (int value = first; value < first + valuesPerThread; value++) {
+                if (!lockFreeSet.insert(value)) stressPassed = false;
+            }
+            for (int value = first; value < first + valuesPerThread; value += 2) {
+                if (!lockFreeSet.remove(value)) stressPassed = false;
+            }
+            for (int value = first; value < first + valuesPerThread; value++) {
+                if (lockFreeSet.containsValue(value) != (value % 2 == 1)) stressPassed = false;
+            }
+        });
+    }
+    for (auto& worker : stressWorkers) {
+        worker.join();
+    }
+    if (lockFreeSet.getSize() != static_cast<size_t>(stressThreads * valuesPerThread / 2)) stressPassed = false;
+    std::cout << "Concurrent stress test (" << stressThreads << " threads): " << (stressPassed ? "passed" : "FAILED")
+              << ", " << lockFreeSet.getSize() << " values in " << lockFreeSet.getBucketCount() << " buckets" << std::endl;
+
+    // Mixed workload: insert/remove races on a shared range, then the size must match the contents
+    std::atomic<long> netInserted(0);
+    stressWorkers.clear();
+    lockFreeSet.clear();
+    for (int t = 0; t < stressThreads; t++) {
+        stressWorkers.emplace_back([&lockFreeSet, &netInserted, t]() {
+            uint32_t state = 2654435761u * (t + 1);
+            for (int i = 0; i < 20000; i++) {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                int value = static_cast<int>(state % 1000);
+                if ((state >> 16) & 1) {
+                    if (lockFreeSet.insert(value)) netInserted++;
+                } else {
+                    if (lockFreeSet.remove(value)) netInserted--;
+                }
+            }
+        });
+    }
+    for (auto& worker : stressWorkers) {
+        worker.join();
+    }
+    long visible = 0;
+    for (int value = 0; value < 1000; value++) {
+        visible += lockFreeSet.containsValue(value);
+    }
+    std::cout << "Mixed insert/remove race: size " << lockFreeSet.getSize() << ", net inserts " << netInserted
+              << ", visible values " << visible << " -> "
+              << (visible == netInserted && static_cast<long>(lockFreeSet.getSize()) == visible ? "passed" : "FAILED") << std::endl;
+
+    // --------------------- Begin RobinHoodHashMap Tests ---------------------
+    std::cout << "\n\n--- Testing RobinHoodHashMap ---" << std::endl;
+
+    RobinHoodHashMap<int, std::string> robinHoodMap(8);
+    for (int i = 1; i <= 6; i++) {
+        robinHoodMap.insert(i * 8, "Number " + std::to_string(i * 8));
+    }
+
+    std::cout << "\nAfter inserting 6 key-value pairs:" << std::endl;
+    robinHoodMap.print();
+    std::cout << "Number of elements: " << robinHoodMap.getSize() << std::endl;
+    std::cout << "Load factor: " << robinHoodMap.getLoadFactor() << std::endl << std::endl;
+
+    std::cout << "Key 24 found? " << (robinHoodMap.contains(24) ? "Yes, value: " + robinHoodMap.get(24) : "No") << std::endl;
+    robinHoodMap.insert(24, "Ignored");  // Existing keys are not overwritten, as in HashMap
+    std::cout << "Value of key 24 after inserting it again: " << robinHoodMap.get(24) << std::endl;
+
+    std::cout << "\nRemoving key 16 (following entries shift back):" << std::endl;
+    robinHoodMap.remove(16);
+    robinHoodMap.print();
+    std::cout << "Key 16 found? " << (robinHoodMap.contains(16) ? "Yes" : "No") << std::endl;
+
+    std::cout << "\nInserting 20 more keys to trigger a resize:" << std::endl;
+    for (int i = 100; i < 120; i++) {
+        robinHoodMap.insert(i, "Number " + std::to_string(i));
+    }
+    std::cout << "Number of elements: " << robinHoodMap.getSize() << std::endl;
+    std::cout << "Current slot count: " << robinHoodMap.getTableSize() << std::endl;
+
+    std::cout << "Clearing the Robin Hood map:" << std::endl;
+    robinHoodMap.clear();
+    std::cout << "Final number of elements: " << robinHoodMap.getSize() << std::endl;
+
+
+    // --------------------- Begin SwissHashSet Tests ---------------------
+    std::cout << "\n\n--- Testing SwissHashSet ---" << std::endl;
+
+    SwissHashSet swissSet(16);
+    for (int i = 1; i <= 10; i++) {
+        swissSet.insert(i * 7);
+    }
+
+    std::cout << "\nAfter inserting 10 values:" << std::endl;
+    swissSet.print();
+    std::cout << "Number of elements: " << swissSet.getSize() << std::endl;
+    std::cout << "Load factor: " << swissSet.getLoadFactor() << std::endl;
+
+    std::cout << "Value 21 found? " << (swissSet.containsValue(21) ? "Yes" : "No") << std::endl;
+    std::cout << "Value 22 found? " << (swissSet.containsValue(22) ? "Yes" : "No") << std::endl;
+
+    std::cout << "\nRemoving value 21:" << std::endl;
+    swissSet.remove(21);
+    std::cout << "Value 21 found? " << (swissSet.containsValue(21) ? "Yes" : "No") << std::endl;
+
+    std::cout << "\nInserting 1000 more values to trigger resizes:" << std::endl;
+    for (int i = 1000; i < 2000; i++) {
+        swissSet.insert(i);
+    }
+    std::cout << "Number of elements: " << swissSet.getSize() << std::endl;
+    std::cout << "Current slot count: " << swissSet.getTableSize() << std::endl;
+    std::cout << "Average probe length (groups): " << swissSet.averageProbeLength() << std::endl;
+    std::cout << "Max probe length (groups): " << swissSet.maxProbeLength() << std::endl;
+
+    std::cout << "Clearing the Swiss set:" << std::endl;
+    swissSet.clear();
+    std::cout << "Final number of elements: " << swissSet.getSize() << std::endl;
+
+
+    // --------------------- Begin CuckooHashMap Tests ---------------------
+    std::cout << "\n\n--- Testing CuckooHashMap ---" << std::endl;
+
+    CuckooHashMap<int, std::string> cuckooMap(16);
+    for (int i = 1; i <= 12; i++) {
+        cuckooMap.insert(i * 8, "Number " + std::to_string(i * 8));
+    }
+    std::cout << "After inserting 12 key-value pairs:" << std::endl;
+    cuckooMap.print();
+    std::cout << "Number of elements: " << cuckooMap.getSize() << std::endl;
+    std::cout << "Load factor: " << cuckooMap.getLoadFactor() << std::endl;
+    std::cout << "Get key 40: " << cuckooMap.get(40) << std::endl;
+    std::cout << "Key 41 found? " << (cuckooMap.contains(41) ? "Yes" : "No") << std::endl;
+
+    std::cout << "\nRemoving key 40:" << std::endl;
+    cuckooMap.remove(40);
+    std::cout << "Key 40 found? " << (cuckooMap.find(40) ? "Yes" : "No") << std::endl;
+
+    std::cout << "\nInserting 1000 more keys (displacements and resizes):" << std::endl;
+    for (int i = 1000; i < 2000; i++) {
+        cuckooMap.insert(i, "Number " + std::to_string(i));
+    }
+    std::cout << "Number of elements: " << cuckooMap.getSize() << std::endl;
+    std::cout << "Current slot count: " << cuckooMap.getTableSize() << std::endl;
+    std::cout << "Entries in the stash: " << cuckooMap.getStashSize() << std::endl;
+
+    // --------------------- Begin StringArenaMap Tests ---------------------
+    std::cout << "\n\n--- Testing StringArenaMap ---" << std::endl;
+
+    StringArenaMap arenaMap;
+    for (int i = 1; i <= 5; i++) {
+        arenaMap.insert("user:" + std::to_string(i), "session-" + std::to_string(i * 7));
+    }
+    std::cout << "After inserting 5 key-value pairs:" << std::endl;
+    arenaMap.print();
+    std::cout << "Get key user:3: " << arenaMap.get("user:3") << std::endl;
+    std::cout << "Key user:9 found? " << (arenaMap.contains("user:9") ? "Yes" : "No") << std::endl;
+    std::cout << "Arena bytes: " << arenaMap.getArenaBytes() << std::endl;
+
+    std::cout << "\nShortening user:1 (in place) and lengthening user:2 (appended):" << std::endl;
+    arenaMap.insertOrAssign("user:1", "s1");
+    arenaMap.insertOrAssign("user:2", "a much longer session value");
+    std::cout << "Get key user:1: " << arenaMap.get("user:1") << std::endl;
+    std::cout << "Get key user:2: " << arenaMap.get("user:2") << std::endl;
+
+    std::cout << "\nRemoving key user:4:" << std::endl;
+    arenaMap.remove("user:4");
+    std::cout << "Key user:4 found? " << (arenaMap.contains("user:4") ? "Yes" : "No") << std::endl;
+    std::cout << "Arena bytes: " << arenaMap.getArenaBytes() << " (dead: " << arenaMap.getDeadBytes() << ")" << std::endl;
+    arenaMap.compact();
+    std::cout << "After compact: " << arenaMap.getArenaBytes() << " (dead: " << arenaMap.getDeadBytes() << ")" << std::endl;
+    std::cout << "Number of elements: " << arenaMap.getSize() << std::endl;
+
+    // --------------------- Begin Snapshot Tests ---------------------
+    std::cout << "\n\n--- Testing snapshots ---" << std::endl;
+
+    HashMap<int, std::string> savedMap(8);
+    for (int i = 1; i <= 6; i++) {
+        savedMap.insert(i * 10, "Number " + std::to_string(i * 10));
+    }
+    savedMap.saveSnapshot("hashTables.snapshot");
+    std::cout << "Saved a map of " << savedMap.getSize() << " elements" << std::endl;
+
+    HashMap<int, std::string> restoredMap;
+    restoredMap.loadSnapshot("hashTables.snapshot");
+    std::cout << "Loaded map: " << restoredMap.getSize() << " elements, "
+              << restoredMap.getTableSize() << " buckets" << std::endl;
+    restoredMap.print();
+
+    HashMapSnapshotView<int, std::string> snapshotView("hashTables.snapshot");
+    std::string_view snapshotValue;
+    if (snapshotView.tryGet(30, snapshotValue)) {
+        std::cout << "Key 30 in the mapped view: " << snapshotValue << std::endl;
+    }
+    std::cout << "Key 35 in the mapped view? " << (snapshotView.contains(35) ? "Yes" : "No") << std::endl;
+
+    HashSet savedSet(7);
+    for (int i = 1; i <= 5; i++) {
+        savedSet.insert(i * 3);
+    }
+    savedSet.saveSnapshot("hashTables.snapshot");
+    HashSet restoredSet;
+    restoredSet.loadSnapshot("hashTables.snapshot");
+    std::cout << "Loaded set contains 9? " << (restoredSet.containsValue(9) ? "Yes" : "No") << std::endl;
+
+    try {
+        HashMap<int, std::string> wrongMap;
+        wrongMap.loadSnapshot("hashTables.snapshot");
+    } catch (const std::runtime_error& e) {
+        std::cout << "Loading the set snapshot into a map: " << e.what() << std::endl;
+    }
+    std::remove("hashTables.snapshot");
+
+    // --------------------- Begin Statistics Tests ---------------------
+    std::cout << "\n\n--- Testing table statistics ---" << std::endl;
+
+    HashMap<int, std::string> statsMap(8);
+    for (int i = 0; i < 1000; i++) {
+        statsMap.insert(i * 7, "Number " + std::to_string(i * 7));
+    }
+    std::cout << "HashMap after 1000 inserts:" << std::endl;
+    statsMap.getStats().print();
+
+    HashSet statsSet(64);
+    for (int i = 0; i < 40; i++) {
+        statsSet.insert(i * 64);   // Every value is a multiple of the table size
+    }
+    HashTableStats setStats = statsSet.getStats();
+    std::cout << "\nHashSet of 40 multiples of 64: average probe length " << setStats.averageProbeLength
+              << ", collision rate " << setStats.collisionRate << std::endl;
+
+    // --------------------- Begin StaticHashMap Tests ---------------------
+    std::cout << "\n\n--- Testing StaticHashMap ---" << std::endl;
+
+    HashMap<std::string, int> monthDays;
+    const char* months[] = {"jan", "feb", "mar", "apr", "may", "jun", "jul", "aug", "sep", "oct", "nov", "dec"};
+    const int days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    for (int i = 0; i < 12; i++) {
+        monthDays.insert(months[i], days[i]);
+    }
+    StaticHashMap<std::string, int> staticMonths(monthDays);
+    std::cout << "Built from a HashMap of " << monthDays.getSize() << " elements: "
+              << staticMonths.getSize() << " entries, " << staticMonths.getBucketCount() << " pilot buckets" << std::endl;
+    std::cout << "Days in feb: " << staticMonths.get("feb") << std::endl;
+    std::cout << "Key 'smarch' found? " << (staticMonths.contains("smarch") ? "Yes" : "No") << std::endl;
+
+    // --------------------- Begin Set Algebra Tests ---------------------
+    std::cout << "\n\n--- Testing HashSet set algebra ---" << std::endl;
+
+    HashSet evens, multiplesOfThree;
+    for (int i = 0; i <= 30; i++) {
+        if (i % 2 == 0) evens.insert(i);
+        if (i % 3 == 0) multiplesOfThree.insert(i);
+    }
+    std::cout << "Evens: " << evens.getSize() << ", multiples of 3: " << multiplesOfThree.getSize()
+              << ", union: " << evens.unionSize(multiplesOfThree)
+              << ", intersection: " << evens.intersectionSize(multiplesOfThree)
+              << ", evens minus multiples of 3: " << evens.differenceSize(multiplesOfThree) << std::endl;
+    HashSet multiplesOfSix(evens.getTableSize());
+    multiplesOfSix.unionWith(evens);
+    multiplesOfSix.intersectWith(multiplesOfThree);
+    std::cout << "Evens intersected with multiples of 3: " << multiplesOfSix.getSize() << " values, 18 present? "
+              << (multiplesOfSix.containsValue(18) ? "Yes" : "No") << ", 4 present? "
+              << (multiplesOfSix.containsValue(4) ? "Yes" : "No") << std::endl;
+    evens.differenceWith(multiplesOfSix);
+    std::cout << "Evens without multiples of 6: " << evens.getSize() << " values" << std::endl;
+
+    // --------------------- Begin ConcurrentCache Tests ---------------------
+    std::cout << "\n\n--- Testing ConcurrentCache ---" << std::endl;
+
+    ConcurrentCache<int, std::string> cache(3, EvictionPolicy::LRU);
+    int storeReads = 0;
+    auto slowStore = [&storeReads](const int& key) {
+        storeReads++;
+        return "Record " + std::to_string(key);
+    };
+    for (int key : {1, 2, 3, 1, 4, 2, 1}) {
+        cache.getOrLoad(key, slowStore);
+    }
+    CacheCounters counters = cache.getCounters();
+    std::cout << "LRU cache of 3 after reading 1 2 3 1 4 2 1: " << counters.hits << " hits, " << counters.misses
+              << " misses, " << counters.evictions << " evictions, " << storeReads << " store reads" << std::endl;
+    std::cout << "Key 3 still cached? " << (cache.contains(3) ? "Yes" : "No")
+              << ", key 1? " << (cache.contains(1) ? "Yes" : "No") << std::endl;
+
+    ConcurrentCache<int, std::string> frequencyCache(100, EvictionPolicy::TINY_LFU);
+    for (int round = 0; round < 5; round++) {
+        for (int key = 0; key < 50; key++) {
+            frequencyCache.getOrLoad(key, slowStore);
+        }
+    }
+    for (int key = 1000; key < 2000; key++) {   // A scan of keys read once
+        frequencyCache.getOrLoad(key, slowStore);
+    }
+    int stillCached = 0;
+    for (int key = 0; key < 50; key++) {
+        stillCached += frequencyCache.contains(key);
+    }
+    std::cout << "W-TinyLFU cache of 100 after a scan of 1000 keys: " << stillCached
+              << " of the 50 frequent keys still cached" << std::endl;
+
+    // --------------------- Begin Iteration Tests ---------------------
+    std::cout << "\n\n--- Testing iterators and parallelForEach ---" << std::endl;
+
+    HashMap<int, std::string> squareNames;
+    for (int i = 1; i <= 10; i++) {
+        squareNames.insert(i, std::to_string(i * i));
+    }
+    size_t digits = 0;
+    for (const auto& pair : squareNames) {
+        digits += pair.second.size();
+    }
+    std::cout << "Digits in the squares of 1..10 (iterator loop): " << digits << std::endl;
+
+    const size_t workers = 4;
+    std::vector<long long> partialSums(workers, 0);
+    HashSet numbers;
+    for (int i = 1; i <= 100000; i++) {
+        numbers.insert(i);
+    }
+    numbers.parallelForEach([&partialSums](size_t worker, int value) { partialSums[worker] += value; }, workers);
+    long long total = 0;
+    for (long long sum : partialSums) {
+        total += sum;
+    }
+    std::cout << "Sum of 1..100000 (parallelForEach, up to " << workers << " threads): " << total << std::endl;
+
+    // --------------------- Begin Filter Tests ---------------------
+    std::cout << "\n\n--- Testing BlockedBloomFilter and CuckooFilter ---" << std::endl;
+
+    BlockedBloomFilter bloom(10000, 0.01);
+    CuckooFilter cuckoo(10000, 0.01);
+    for (int i = 0; i < 10000; i++) {
+        bloom.insert(i * 2);    // Even numbers only
+        cuckoo.insert(i * 2);
+    }
+    std::cout << "Bloom filter: " << bloom.getBlockCount() << " blocks, " << bloom.getMemoryBytes() << " bytes" << std::endl;
+    std::cout << "Cuckoo filter: " << cuckoo.getBucketCount() << " buckets, " << cuckoo.getFingerprintBits()
+              << "-bit fingerprints, " << cuckoo.getMemoryBytes() << " bytes" << std::endl;
+    std::cout << "Value 42 might be present? Bloom: " << (bloom.mightContain(42) ? "Yes" : "No")
+              << ", Cuckoo: " << (cuckoo.mightContain(42) ? "Yes" : "No") << std::endl;
+
+    size_t bloomFalsePositives = 0, cuckooFalsePositives = 0;
+    for (int i = 0; i < 10000; i++) {
+        bloomFalsePositives += bloom.mightContain(i * 2 + 1);   // Odd numbers were never inserted
+        cuckooFalsePositives += cuckoo.mightContain(i * 2 + 1);
+    }
+    std::cout << "False positives among 10000 odd numbers: Bloom " << bloomFalsePositives
+              << " (expected about " << bloom.estimatedFalsePositiveRate() * 10000 << "), Cuckoo "
+              << cuckooFalsePositives << " (expected about " << cuckoo.estimatedFalsePositiveRate() * 10000 << ")" << std::endl;
+
+    std::cout << "\nRemoving value 42 from the cuckoo filter:" << std::endl;
+    cuckoo.remove(42);
+    std::cout << "Value 42 might be present? " << (cuckoo.mightContain(42) ? "Yes" : "No") << std::endl;
+    std::cout << "Number of elements: " << cuckoo.getSize() << std::endl;
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>   // For size_t
+#include <exception>
+#include <functional>
+#include <thread>
+#include <vector>
+
+// runInParallel: Splits 0..count - 1 into contiguous ranges of at least 'minPerWorker'
+// items, at most 'threads' of them, and calls work(worker, begin, end) for each range.
+// Worker 0 runs on the calling thread, the others on threads of their own; the call
+// returns once every range is done. If a worker throws, the first exception (by
+// worker number) is rethrown after all of them have finished.
+inline void runInParallel(size_t count, size_t threads, size_t minPerWorker,
+                          const std::function<void(size_t worker, size_t begin, size_t end)>& work) {
+    size_t workers = minPerWorker == 0 ? count : count / minPerWorker;
+    workers = workers < threads ? workers : threads;
+    workers = workers < 1 ? 1 : workers;
+    size_t slice = (count + workers - 1) / workers;
+
+    std::vector<std::exception_ptr> errors(workers);
+    auto runRange = [&](size_t worker) {
+        size_t begin = worker * slice < count ? worker * slice : count;
+        size_t end = begin + slice < count ? begin + slice : count;
+        try {
+            work(worker, begin, end);
+        } catch (...) {
+            errors[worker] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t worker = 1; worker < workers; worker++) {
+        pool.emplace_back(runRange, worker);
+    }
+    runRange(0);
+    for (std::thread& thread : pool) {
+        thread.join();
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
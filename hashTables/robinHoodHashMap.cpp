@@ -0,0 +1,259 @@
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint32_t, uint64_t
+#include <stdexcept>
+#include <string>
+#include <utility>   // For std::swap, std::move
+#include <vector>
+#include <iostream>
+#include "robinHoodHashMap.h"
+
+template class RobinHoodHashMap<int, std::string>;
+
+// Rounds a requested table size up to the next power of two (at least 'minimum').
+static size_t roundUpToPowerOfTwo(size_t size, size_t minimum) {
+    size_t power = minimum;
+    while (power < size) {
+        power *= 2;
+    }
+    return power;
+}
+
+// Returns log2 of a power of two.
+static int log2OfPowerOfTwo(size_t size) {
+    int bits = 0;
+    while ((static_cast<size_t>(1) << bits) < size) {
+        bits++;
+    }
+    return bits;
+}
+
+// An empty slot.
+template<typename KeyType, typename ValueType, typename Hasher>
+RobinHoodHashMap<KeyType, ValueType, Hasher>::Slot::Slot() : key(), value(), distance(0) { }
+
+// Computes the home slot from the top bits of the key's hash.
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t RobinHoodHashMap<KeyType, ValueType, Hasher>::hashFunction(const KeyType& key) const {
+    return static_cast<size_t>(this->hasher(key) >> this->hashShift);
+}
+
+// Finds the slot holding the key; the probe stops as soon as it meets an entry
+// closer to its home than we are to ours, since the key would have displaced it.
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t RobinHoodHashMap<KeyType, ValueType, Hasher>::findSlot(const KeyType& key) const {
+    size_t mask = this->tableSize - 1;
+    size_t index = this->hashFunction(key);
+    uint32_t distance = 1;
+
+    while (true) {
+        const Slot& slot = this->table[index];
+        if (slot.distance < distance) {    // Also covers empty slots (distance 0)
+            return this->tableSize;
+        }
+        if (slot.distance == distance && slot.key == key) {
+            return index;
+        }
+        index = (index + 1) & mask;
+        distance++;
+    }
+}
+
+// Places an entry whose key is known to be absent: no key comparisons are needed.
+template<typename KeyType, typename ValueType, typename Hasher>
+void RobinHoodHashMap<KeyType, ValueType, Hasher>::placeSlot(Slot&& carried) {
+    size_t mask = this->tableSize - 1;
+    size_t index = this->hashFunction(carried.key);
+    carried.distance = 1;
+
+    while (true) {
+        Slot& slot = this->table[index];
+        if (slot.distance == 0) {
+            slot = std::move(carried);
+            this->numElements++;
+            return;
+        }
+        if (slot.distance < carried.distance) {
+            std::swap(slot, carried);
+        }
+        index = (index + 1) & mask;
+        carried.distance++;
+    }
+}
+
+// Moves every entry into a table of 'newSize' slots.
+template<typename KeyType, typename ValueType, typename Hasher>
+void RobinHoodHashMap<KeyType, ValueType, Hasher>::rehash(size_t newSize) {
+    this->resizeCounters.countResize(this->tableSize, newSize);
+    RehashTimer timer(this->resizeCounters);
+    std::vector<Slot> oldTable(newSize);
+    oldTable.swap(this->table);
+    this->tableSize = newSize;
+    this->hashShift = 64 - log2OfPowerOfTwo(newSize);
+    this->numElements = 0;
+
+    for (auto& slot : oldTable) {
+        if (slot.distance != 0) {
+            this->placeSlot(std::move(slot));
+        }
+    }
+}
+
+// Doubles the table size and rehashes all elements.
+template<typename KeyType, typename ValueType, typename Hasher>
+void RobinHoodHashMap<KeyType, ValueType, Hasher>::resizeUp() {
+    this->rehash(this->tableSize * 2);
+}
+
+// Halves the table size (not below MIN_TABLE_SIZE) and rehashes all elements.
+template<typename KeyType, typename ValueType, typename Hasher>
+void RobinHoodHashMap<KeyType, ValueType, Hasher>::resizeDown() {
+    size_t newSize = this->tableSize / 2;
+    if (newSize < MIN_TABLE_SIZE) {
+        newSize = MIN_TABLE_SIZE;
+    }
+    if (newSize != this->tableSize) {
+        this->rehash(newSize);
+    }
+}
+
+// Constructor rounds the requested size up to a power of two.
+template<typename KeyType, typename ValueType, typename Hasher>
+RobinHoodHashMap<KeyType, ValueType, Hasher>::RobinHoodHashMap(size_t size, const Hasher& hasher)
+    : numElements(0), hasher(hasher) {
+    this->tableSize = roundUpToPowerOfTwo(size, MIN_TABLE_SIZE);
+    this->hashShift = 64 - log2OfPowerOfTwo(this->tableSize);
+    this->table.resize(this->tableSize);
+}
+
+// Returns the current load factor (elements/table size).
+template<typename KeyType, typename ValueType, typename Hasher>
+double RobinHoodHashMap<KeyType, ValueType, Hasher>::getLoadFactor() const {
+    return static_cast<double>(this->numElements) / this->tableSize;
+}
+
+// Inserts a new key-value pair in a single probe: while walking, any entry that is
+// closer to its home than the one we carry is swapped out and carried onwards.
+template<typename KeyType, typename ValueType, typename Hasher>
+void RobinHoodHashMap<KeyType, ValueType, Hasher>::insert(const KeyType& key, const ValueType& value) {
+    if (static_cast<double>(this->numElements + 1) > this->tableSize * MAX_LOAD_FACTOR) {
+        if (this->contains(key)) return;
+        resizeUp();
+    }
+
+    size_t mask = this->tableSize - 1;
+    size_t index = this->hashFunction(key);
+    Slot carried;
+    carried.key = key;
+    carried.value = value;
+    carried.distance = 1;
+    bool carryingNewKey = true;     // Until the first swap we carry the inserted key
+
+    while (true) {
+        Slot& slot = this->table[index];
+        if (slot.distance == 0) {
+            slot = std::move(carried);
+            this->numElements++;
+            return;
+        }
+        if (carryingNewKey && slot.distance == carried.distance && slot.key == key) {
+            return;                 // Already present: keep the existing value
+        }
+        if (slot.distance < carried.distance) {
+            std::swap(slot, carried);
+            carryingNewKey = false; // The key cannot appear further on (see findSlot)
+        }
+        index = (index + 1) & mask;
+        carried.distance++;
+    }
+}
+
+// Removes the key and shifts the following displaced entries one slot back.
+template<typename KeyType, typename ValueType, typename Hasher>
+void RobinHoodHashMap<KeyType, ValueType, Hasher>::remove(const KeyType& key) {
+    size_t index = this->findSlot(key);
+    if (index == this->tableSize) return;
+
+    size_t mask = this->tableSize - 1;
+    size_t next = (index + 1) & mask;
+    while (this->table[next].distance > 1) {   // Stop at an empty slot or an entry already at home
+        this->table[index] = std::move(this->table[next]);
+        this->table[index].distance--;
+        index = next;
+        next = (next + 1) & mask;
+    }
+    this->table[index] = Slot();
+    this->numElements--;
+
+    if (getLoadFactor() < MIN_LOAD_FACTOR) {
+        resizeDown();
+    }
+}
+
+// Returns a reference to the value for the given key; throws if not found.
+template<typename KeyType, typename ValueType, typename Hasher>
+ValueType& RobinHoodHashMap<KeyType, ValueType, Hasher>::get(const KeyType& key) {
+    size_t index = this->findSlot(key);
+    if (index == this->tableSize) {
+        throw std::out_of_range("Key not found");
+    }
+    return this->table[index].value;
+}
+
+// Checks if the key exists in the map.
+template<typename KeyType, typename ValueType, typename Hasher>
+bool RobinHoodHashMap<KeyType, ValueType, Hasher>::contains(const KeyType& key) const {
+    return this->findSlot(key) != this->tableSize;
+}
+
+// Clears all elements, keeping the current number of slots.
+template<typename KeyType, typename ValueType, typename Hasher>
+void RobinHoodHashMap<KeyType, ValueType, Hasher>::clear() {
+    this->table.assign(this->tableSize, Slot());
+    this->numElements = 0;
+}
+
+// Returns the number of key-value pairs stored.
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t RobinHoodHashMap<KeyType, ValueType, Hasher>::getSize() const {
+    return this->numElements;
+}
+
+// Returns the current number of slots in the table.
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t RobinHoodHashMap<KeyType, ValueType, Hasher>::getTableSize() const {
+    return this->tableSize;
+}
+
+// An entry's home slot is its index minus its displacement, so no key is hashed.
+template<typename KeyType, typename ValueType, typename Hasher>
+HashTableStats RobinHoodHashMap<KeyType, ValueType, Hasher>::getStats() const {
+    HashTableStats stats;
+    std::vector<bool> isHome(this->tableSize, false);
+    size_t homeSlots = 0;
+    for (size_t i = 0; i < this->tableSize; i++) {
+        const Slot& slot = this->table[i];
+        if (slot.distance != 0) {
+            stats.addEntry(slot.distance - 1);
+            size_t home = (i - (slot.distance - 1)) & (this->tableSize - 1);
+            if (!isHome[home]) {
+                isHome[home] = true;
+                homeSlots++;
+            }
+        }
+    }
+    stats.finish(this->numElements, this->tableSize, homeSlots, this->resizeCounters);
+    return stats;
+}
+
+// Prints each slot with its probe distance for debugging.
+template<typename KeyType, typename ValueType, typename Hasher>
+void RobinHoodHashMap<KeyType, ValueType, Hasher>::print() const {
+    for (size_t i = 0; i < this->table.size(); i++) {
+        std::cout << "Slot " << i << ": ";
+        if (this->table[i].distance != 0) {
+            std::cout << "(" << this->table[i].key << ", " << this->table[i].value << ") "
+                      << "[distance " << this->table[i].distance - 1 << "]";
+        }
+        std::cout << std::endl;
+    }
+}
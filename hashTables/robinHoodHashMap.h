@@ -0,0 +1,85 @@
+#pragma once
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint32_t
+#include <stdexcept>
+#include <vector>
+#include <iostream>
+#include "hashFunctions.h"
+#include "hashTableStats.h"
+
+
+// Open-addressing hash map with Robin Hood probing.
+// Entries live directly in one flat array: no per-entry allocation and no pointer
+// chasing. On a collision the entry that is closer to its home slot gives way
+// ("takes from the rich"), which keeps probe lengths short and lets lookups stop
+// early. Removal shifts the following entries back instead of leaving tombstones.
+template<typename KeyType, typename ValueType, typename Hasher = DefaultHash<KeyType>>
+class RobinHoodHashMap {
+private:
+    // One slot of the table
+    struct Slot {
+        KeyType key;
+        ValueType value;
+        uint32_t distance;   // Probe distance from the home slot + 1, 0 marks an empty slot
+
+        Slot();
+    };
+
+    std::vector<Slot> table;
+    size_t tableSize;     // Number of slots, always a power of two
+    size_t numElements;
+    int hashShift;        // 64 - log2(tableSize): the home slot is the top bits of the hash
+    Hasher hasher;
+    ResizeCounters resizeCounters;
+
+    const double MAX_LOAD_FACTOR = 0.9;
+    const double MIN_LOAD_FACTOR = 0.2;
+    const size_t MIN_TABLE_SIZE = 8;
+
+    // Home slot of a key: the top log2(tableSize) bits of its hash
+    size_t hashFunction(const KeyType& key) const;
+
+    // Index of the slot holding 'key', or tableSize if it is absent
+    size_t findSlot(const KeyType& key) const;
+
+    // Places an entry whose key is known to be absent, displacing richer entries
+    void placeSlot(Slot&& slot);
+
+    // Moves every entry into a table of 'newSize' slots
+    void rehash(size_t newSize);
+
+    void resizeUp();
+
+    void resizeDown();
+
+public:
+    // Constructor: the requested size is rounded up to a power of two
+    explicit RobinHoodHashMap(size_t size = 128, const Hasher& hasher = Hasher());
+
+    ~RobinHoodHashMap() = default;
+
+    double getLoadFactor() const;
+
+    // insert: Adds the pair if the key is not present yet (same semantics as HashMap)
+    void insert(const KeyType& key, const ValueType& value);
+
+    // remove: Removes the key if present, shifting the following entries back
+    void remove(const KeyType& key);
+
+    // get: Returns a reference to the value of the key; throws if not found
+    ValueType& get(const KeyType& key);
+
+    bool contains(const KeyType& key) const;
+
+    void clear();
+
+    size_t getSize() const;
+
+    size_t getTableSize() const;
+
+    // getStats: Displacement histogram, probe lengths, collision rate and resize
+    // history (see hashTableStats.h)
+    HashTableStats getStats() const;
+
+    void print() const;
+};
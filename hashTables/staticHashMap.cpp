@@ -0,0 +1,236 @@
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint16_t, uint32_t, uint64_t
+#include <cmath>     // For std::ceil, std::log2
+#include <stdexcept>
+#include <string>
+#include <utility>   // For std::pair, std::move
+#include <vector>
+#include "staticHashMap.h"
+
+template class StaticHashMap<int, std::string>;
+template class StaticHashMap<std::string, int>;
+template class StaticHashMap<std::string, std::string>;
+
+// Maps a uniform 64-bit value to 0..range - 1 with a multiply instead of a division
+static size_t fastRange(uint64_t value, size_t range) {
+#if defined(__SIZEOF_INT128__)
+    return static_cast<size_t>((static_cast<__uint128_t>(value) * range) >> 64);
+#else
+    return static_cast<size_t>(value % range);
+#endif
+}
+
+// Dense buckets take the keys whose selector falls below 60% of 2^32. One 64-bit multiply
+// (Fibonacci hashing) spreads the hash first, so a hasher that leaves the high bits
+// empty, like the identity, still fills every bucket.
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t StaticHashMap<KeyType, ValueType, Hasher>::bucketOf(uint64_t hash) const {
+    uint64_t mixed = hash * hashing::SECRET0;
+    uint64_t selector = mixed & 0xFFFFFFFFULL;
+    uint64_t spread = mixed >> 32;
+    size_t sparseBuckets = this->pilots.size() - this->denseBuckets;
+    if (selector < 0x99999999ULL || sparseBuckets == 0) {   // 0x99999999 / 2^32 = 0.6
+        return static_cast<size_t>((spread * this->denseBuckets) >> 32);
+    }
+    return this->denseBuckets + static_cast<size_t>((spread * sparseBuckets) >> 32);
+}
+
+// Each pilot selects an independent position: the key's hash, offset by the pilot, is
+// mixed again, so two keys that collide under one pilot rarely collide under the next.
+// The seed changes every position at once when a build attempt is retried.
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t StaticHashMap<KeyType, ValueType, Hasher>::positionOf(uint64_t hash, uint16_t pilot) const {
+    uint64_t pilotOffset = static_cast<uint64_t>(pilot) * hashing::SECRET2;
+    return fastRange(hashing::hashMix(hash ^ pilotOffset, hashing::SECRET3 ^ this->seed), this->numPositions);
+}
+
+// Buckets are placed from the largest to the smallest; each takes the first pilot that
+// puts all of its keys on distinct free positions.
+template<typename KeyType, typename ValueType, typename Hasher>
+bool StaticHashMap<KeyType, ValueType, Hasher>::tryBuild(const std::vector<uint64_t>& hashes,
+                                                         std::vector<size_t>& positions) {
+    size_t bucketCount = this->pilots.size();
+
+    // Keys grouped by bucket (counting sort)
+    std::vector<size_t> bucketStart(bucketCount + 1, 0);
+    std::vector<size_t> bucketOfKey(hashes.size());
+    for (size_t i = 0; i < hashes.size(); i++) {
+        bucketOfKey[i] = this->bucketOf(hashes[i]);
+        bucketStart[bucketOfKey[i] + 1]++;
+    }
+    size_t maxBucketSize = 0;
+    for (size_t b = 0; b < bucketCount; b++) {
+        if (bucketStart[b + 1] > maxBucketSize) {
+            maxBucketSize = bucketStart[b + 1];
+        }
+        bucketStart[b + 1] += bucketStart[b];
+    }
+    std::vector<size_t> keysByBucket(hashes.size());
+    std::vector<size_t> cursor(bucketStart.begin(), bucketStart.end() - 1);
+    for (size_t i = 0; i < hashes.size(); i++) {
+        keysByBucket[cursor[bucketOfKey[i]]++] = i;
+    }
+
+    // Buckets grouped by size, largest first (counting sort again)
+    std::vector<std::vector<size_t>> bucketsBySize(maxBucketSize + 1);
+    for (size_t b = 0; b < bucketCount; b++) {
+        bucketsBySize[bucketStart[b + 1] - bucketStart[b]].push_back(b);
+    }
+
+    std::vector<bool> taken(this->numPositions, false);
+    std::vector<size_t> candidates(maxBucketSize);
+    for (size_t size = maxBucketSize; size > 0; size--) {
+        for (size_t bucket : bucketsBySize[size]) {
+            const size_t* keys = keysByBucket.data() + bucketStart[bucket];
+            bool placed = false;
+            for (uint32_t pilot = 0; pilot <= 0xFFFF && !placed; pilot++) {
+                placed = true;
+                for (size_t j = 0; j < size && placed; j++) {
+                    candidates[j] = this->positionOf(hashes[keys[j]], static_cast<uint16_t>(pilot));
+                    placed = !taken[candidates[j]];
+                    for (size_t k = 0; k < j && placed; k++) {
+                        placed = candidates[k] != candidates[j];
+                    }
+                }
+                if (placed) {
+                    this->pilots[bucket] = static_cast<uint16_t>(pilot);
+                    for (size_t j = 0; j < size; j++) {
+                        taken[candidates[j]] = true;
+                        positions[keys[j]] = candidates[j];
+                    }
+                }
+            }
+            if (!placed) {
+                for (size_t j = 0; j < size; j++) {
+                    for (size_t k = 0; k < j; k++) {
+                        if (hashes[keys[j]] == hashes[keys[k]]) {
+                            throw std::invalid_argument("Two keys have the same hash: no perfect hash exists");
+                        }
+                    }
+                }
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Constructor: copies the pairs out of the map, finds the pilots, then moves every pair
+// to its final index
+template<typename KeyType, typename ValueType, typename Hasher>
+StaticHashMap<KeyType, ValueType, Hasher>::StaticHashMap(const HashMap<KeyType, ValueType, Hasher>& map,
+                                                         const Hasher& hasher)
+    : numElements(0), numPositions(0), denseBuckets(1), seed(0), hasher(hasher) {
+    std::vector<std::pair<KeyType, ValueType>> items;
+    items.reserve(map.getSize());
+    map.forEach([&items](const KeyType& key, const ValueType& value) { items.push_back(std::make_pair(key, value)); });
+    if (items.size() >= (static_cast<uint64_t>(1) << 32)) {
+        throw std::length_error("StaticHashMap cannot hold 2^32 or more keys");
+    }
+    this->numElements = items.size();
+    this->numPositions = static_cast<size_t>(std::ceil(this->numElements / POSITION_LOAD));
+    if (this->numPositions < this->numElements) {
+        this->numPositions = this->numElements;
+    }
+    double logKeys = this->numElements > 2 ? std::log2(static_cast<double>(this->numElements)) : 1.0;
+    size_t bucketCount = static_cast<size_t>(std::ceil(BUCKET_FACTOR * this->numElements / logKeys));
+    bucketCount = bucketCount < 1 ? 1 : bucketCount;
+    this->denseBuckets = static_cast<size_t>(bucketCount * 0.3);
+    this->denseBuckets = this->denseBuckets < 1 ? 1 : this->denseBuckets;
+
+    std::vector<uint64_t> hashes(this->numElements);
+    for (size_t i = 0; i < this->numElements; i++) {
+        hashes[i] = this->hasher(items[i].first);
+    }
+    std::vector<size_t> positions(this->numElements);
+    bool built = false;
+    for (size_t attempt = 0; attempt < MAX_ATTEMPTS && !built; attempt++) {
+        this->seed = hashing::hashMix(attempt ^ hashing::SECRET3, hashing::SECRET0);
+        this->pilots.assign(bucketCount, 0);
+        built = this->tryBuild(hashes, positions);
+    }
+    if (!built) {
+        throw std::runtime_error("No perfect hash found for these keys");
+    }
+
+    // Positions past n are sent, in order, to the indices below n that no key took
+    std::vector<bool> used(this->numElements, false);
+    for (size_t position : positions) {
+        if (position < this->numElements) {
+            used[position] = true;
+        }
+    }
+    this->remap.assign(this->numPositions - this->numElements, 0);
+    size_t nextFree = 0;
+    std::vector<size_t> keyAt(this->numElements);
+    for (size_t i = 0; i < this->numElements; i++) {
+        size_t position = positions[i];
+        if (position >= this->numElements) {
+            while (used[nextFree]) {
+                nextFree++;
+            }
+            used[nextFree] = true;
+            this->remap[position - this->numElements] = static_cast<uint32_t>(nextFree);
+            position = nextFree;
+        }
+        keyAt[position] = i;
+    }
+
+    this->entries.reserve(this->numElements);
+    for (size_t position = 0; position < this->numElements; position++) {
+        this->entries.push_back(std::move(items[keyAt[position]]));
+    }
+}
+
+// One pilot read, one entry read: there is exactly one place the key can be
+template<typename KeyType, typename ValueType, typename Hasher>
+const ValueType* StaticHashMap<KeyType, ValueType, Hasher>::find(const LookupKey& key) const {
+    if (this->numElements == 0) {
+        return nullptr;
+    }
+    uint64_t hash = this->hasher(key);
+    size_t position = this->positionOf(hash, this->pilots[this->bucketOf(hash)]);
+    if (position >= this->numElements) {
+        position = this->remap[position - this->numElements];
+    }
+    const std::pair<KeyType, ValueType>& entry = this->entries[position];
+    return entry.first == key ? &entry.second : nullptr;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+const ValueType& StaticHashMap<KeyType, ValueType, Hasher>::get(const LookupKey& key) const {
+    const ValueType* value = this->find(key);
+    if (value == nullptr) {
+        throw std::out_of_range("Key not found");
+    }
+    return *value;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+bool StaticHashMap<KeyType, ValueType, Hasher>::contains(const LookupKey& key) const {
+    return this->find(key) != nullptr;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t StaticHashMap<KeyType, ValueType, Hasher>::getSize() const {
+    return this->numElements;
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t StaticHashMap<KeyType, ValueType, Hasher>::getBucketCount() const {
+    return this->pilots.size();
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+size_t StaticHashMap<KeyType, ValueType, Hasher>::getMemoryBytes() const {
+    return this->entries.capacity() * sizeof(std::pair<KeyType, ValueType>)
+           + this->pilots.capacity() * sizeof(uint16_t) + this->remap.capacity() * sizeof(uint32_t);
+}
+
+template<typename KeyType, typename ValueType, typename Hasher>
+double StaticHashMap<KeyType, ValueType, Hasher>::getBitsPerKey() const {
+    if (this->numElements == 0) {
+        return 0;
+    }
+    return 8.0 * (this->pilots.size() * sizeof(uint16_t) + this->remap.size() * sizeof(uint32_t)) / this->numElements;
+}
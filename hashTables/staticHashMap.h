@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint16_t, uint32_t, uint64_t
+#include <stdexcept>
+#include <utility>   // For std::pair
+#include <vector>
+#include "hashFunctions.h"
+#include "hashMap.h"
+
+
+// Immutable map built once from a HashMap, for tables that are only read afterwards.
+//
+// A minimal perfect hash (the "hash and displace" family: CHD, PTHash) sends each of
+// the n keys to its own index in 0..n-1, so the entries sit in an array of exactly n
+// pairs: no empty slots, no chains, no probing. Keys are split into small buckets,
+// and every bucket stores a 16-bit pilot: the seed that places all of its keys on
+// free indices. A lookup hashes the key once, reads the pilot of its bucket (an
+// array of about 0.4 bytes per key, which mostly stays in cache) and then reads the
+// single entry the key can be in. The stored key is compared, so absent keys are
+// reported as absent.
+//
+// Pilots are searched over n / 0.99 indices rather than n, which keeps the search for
+// the last buckets short; the few keys that land past n are sent to the free indices
+// below n through a small remap array.
+template<typename KeyType, typename ValueType, typename Hasher = DefaultHash<KeyType>>
+class StaticHashMap {
+public:
+    using LookupKey = typename HasherLookupType<KeyType, Hasher>::type;
+
+private:
+    std::vector<std::pair<KeyType, ValueType>> entries;   // Exactly one per key
+    std::vector<uint16_t> pilots;                         // One per bucket
+    std::vector<uint32_t> remap;                          // Index for positions n..positions - 1
+    size_t numElements;
+    size_t numPositions;       // n / 0.99: the range the pilots place keys in
+    size_t denseBuckets;       // Buckets receiving 60% of the keys (see bucketOf)
+    uint64_t seed;
+    Hasher hasher;
+
+    const double BUCKET_FACTOR = 5.0;    // Buckets: 5 n / log2(n), about 4-5 keys per bucket
+    const double POSITION_LOAD = 0.99;
+    const size_t MAX_ATTEMPTS = 16;      // Seeds tried before the build gives up
+
+    // Bucket of a hash. 60% of the keys go to the first 30% of the buckets: the large
+    // buckets are placed first, while most indices are free, and the many small ones
+    // fill the rest.
+    size_t bucketOf(uint64_t hash) const;
+
+    // Index in 0..numPositions - 1 of a hash under a pilot
+    size_t positionOf(uint64_t hash, uint16_t pilot) const;
+
+    // Searches pilots for every bucket with the current seed; false if some bucket
+    // has none (the caller retries with another seed)
+    bool tryBuild(const std::vector<uint64_t>& hashes, std::vector<size_t>& positions);
+
+public:
+    // Constructor: Builds the map from the contents of 'map'. Throws std::invalid_argument
+    // if two keys have the same 64-bit hash (no seed can separate them), and
+    // std::length_error for 2^32 or more keys.
+    explicit StaticHashMap(const HashMap<KeyType, ValueType, Hasher>& map, const Hasher& hasher = Hasher());
+
+    // find: Returns a pointer to the value of the key, or nullptr if it is absent
+    const ValueType* find(const LookupKey& key) const;
+
+    // get: Returns a reference to the value of the key; throws std::out_of_range if not found
+    const ValueType& get(const LookupKey& key) const;
+
+    bool contains(const LookupKey& key) const;
+
+    size_t getSize() const;
+
+    size_t getBucketCount() const;
+
+    // getMemoryBytes: Bytes of the entry, pilot and remap arrays (not the heap memory
+    // the keys and values may own themselves)
+    size_t getMemoryBytes() const;
+
+    // getBitsPerKey: Bits of pilot and remap data per key: the cost of the perfect hash
+    double getBitsPerKey() const;
+};
@@ -0,0 +1,250 @@
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint32_t, uint64_t
+#include <cstring>   // For std::memcmp, std::memmove
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "stringArenaMap.h"
+
+// Hash function (BytesHash): the same bytes hash the same whether they come from a
+// std::string or from the arena
+uint64_t StringArenaMap::hashFunction(std::string_view key) {
+    return BytesHash()(key);
+};
+
+// Linear probing from the home slot; the cached hash and the length rule out almost
+// every other key before its bytes are compared
+size_t StringArenaMap::findSlot(std::string_view key, uint32_t hash) const {
+    size_t mask = this->tableSize - 1;
+    for (size_t index = hash & mask; this->slots[index].occupied; index = (index + 1) & mask) {
+        const Slot& slot = this->slots[index];
+        if (slot.hash == hash && slot.keyLength == key.size()
+            && std::memcmp(this->arena.data() + slot.offset, key.data(), key.size()) == 0) {
+            return index;
+        }
+    }
+    return this->tableSize;
+};
+
+uint64_t StringArenaMap::appendEntry(std::string_view key, std::string_view value) {
+    uint64_t offset = this->arena.size();
+    this->arena.insert(this->arena.end(), key.begin(), key.end());
+    this->arena.insert(this->arena.end(), value.begin(), value.end());
+    return offset;
+};
+
+bool StringArenaMap::pointsIntoArena(std::string_view text) const {
+    const char* begin = this->arena.data();
+    return !text.empty() && text.data() >= begin && text.data() < begin + this->arena.size();
+};
+
+// Rehashing reads only the cached hashes; the arena is left untouched
+void StringArenaMap::rehash(size_t newSize) {
+    std::vector<Slot> oldSlots(newSize, Slot());
+    oldSlots.swap(this->slots);
+    this->tableSize = newSize;
+    size_t mask = newSize - 1;
+
+    for (const Slot& slot : oldSlots) {
+        if (slot.occupied) {
+            size_t index = slot.hash & mask;
+            while (this->slots[index].occupied) {
+                index = (index + 1) & mask;
+            }
+            this->slots[index] = slot;
+        }
+    }
+};
+
+void StringArenaMap::compactIfWasteful() {
+    if (this->deadBytes >= MIN_COMPACT_BYTES && this->deadBytes > this->arena.size() - this->deadBytes) {
+        this->compact();
+    }
+};
+
+void StringArenaMap::insertNew(std::string_view key, std::string_view value, uint32_t hash) {
+    // Copy arguments that view the arena itself: appending may reallocate it
+    std::string keyCopy, valueCopy;
+    if (this->pointsIntoArena(key)) {
+        keyCopy.assign(key);
+        key = keyCopy;
+    }
+    if (this->pointsIntoArena(value)) {
+        valueCopy.assign(value);
+        value = valueCopy;
+    }
+
+    if (static_cast<double>(this->numElements + 1) > this->tableSize * MAX_LOAD_FACTOR) {
+        this->rehash(this->tableSize * 2);
+    }
+    size_t mask = this->tableSize - 1;
+    size_t index = hash & mask;
+    while (this->slots[index].occupied) {
+        index = (index + 1) & mask;
+    }
+
+    Slot& slot = this->slots[index];
+    slot.offset = this->appendEntry(key, value);
+    slot.keyLength = static_cast<uint32_t>(key.size());
+    slot.valueLength = static_cast<uint32_t>(value.size());
+    slot.hash = hash;
+    slot.occupied = 1;
+    this->numElements++;
+};
+
+// Constructor: Rounds the requested number of slots up to a power of two
+StringArenaMap::StringArenaMap(size_t size) : tableSize(0), numElements(0), deadBytes(0) {
+    this->tableSize = MIN_TABLE_SIZE;
+    while (this->tableSize < size) {
+        this->tableSize *= 2;
+    }
+    this->slots.assign(this->tableSize, Slot());
+};
+
+double StringArenaMap::getLoadFactor() const {
+    return static_cast<double>(this->numElements) / this->tableSize;
+};
+
+bool StringArenaMap::insert(std::string_view key, std::string_view value) {
+    uint32_t hash = static_cast<uint32_t>(hashFunction(key));
+    if (this->findSlot(key, hash) != this->tableSize) {
+        return false;
+    }
+    this->insertNew(key, value, hash);
+    return true;
+};
+
+bool StringArenaMap::insertOrAssign(std::string_view key, std::string_view value) {
+    uint32_t hash = static_cast<uint32_t>(hashFunction(key));
+    size_t index = this->findSlot(key, hash);
+    if (index == this->tableSize) {
+        this->insertNew(key, value, hash);
+        return true;
+    }
+
+    Slot& slot = this->slots[index];
+    if (value.size() <= slot.valueLength) {
+        // Overwrite in place; memmove since 'value' may view the arena
+        std::memmove(this->arena.data() + slot.offset + slot.keyLength, value.data(), value.size());
+        this->deadBytes += slot.valueLength - value.size();
+    } else {
+        std::string keyCopy, valueCopy;
+        if (this->pointsIntoArena(key)) {
+            keyCopy.assign(key);
+            key = keyCopy;
+        }
+        if (this->pointsIntoArena(value)) {
+            valueCopy.assign(value);
+            value = valueCopy;
+        }
+        this->deadBytes += slot.keyLength + slot.valueLength;
+        slot.offset = this->appendEntry(key, value);
+    }
+    slot.valueLength = static_cast<uint32_t>(value.size());
+
+    this->compactIfWasteful();
+    return false;
+};
+
+// remove: Backward-shift deletion. Each following entry of the probe run moves into the
+// hole unless its home slot lies after the hole, so no tombstones are needed.
+bool StringArenaMap::remove(std::string_view key) {
+    uint32_t hash = static_cast<uint32_t>(hashFunction(key));
+    size_t hole = this->findSlot(key, hash);
+    if (hole == this->tableSize) {
+        return false;
+    }
+    this->deadBytes += this->slots[hole].keyLength + this->slots[hole].valueLength;
+
+    size_t mask = this->tableSize - 1;
+    for (size_t next = (hole + 1) & mask; this->slots[next].occupied; next = (next + 1) & mask) {
+        size_t home = this->slots[next].hash & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            this->slots[hole] = this->slots[next];
+            hole = next;
+        }
+    }
+    this->slots[hole] = Slot();
+    this->numElements--;
+
+    this->compactIfWasteful();
+    return true;
+};
+
+std::string_view StringArenaMap::get(std::string_view key) const {
+    std::string_view value;
+    if (!this->tryGet(key, value)) {
+        throw std::out_of_range("Key not found");
+    }
+    return value;
+};
+
+bool StringArenaMap::tryGet(std::string_view key, std::string_view& value) const {
+    size_t index = this->findSlot(key, static_cast<uint32_t>(hashFunction(key)));
+    if (index == this->tableSize) {
+        return false;
+    }
+    const Slot& slot = this->slots[index];
+    value = std::string_view(this->arena.data() + slot.offset + slot.keyLength, slot.valueLength);
+    return true;
+};
+
+bool StringArenaMap::contains(std::string_view key) const {
+    return this->findSlot(key, static_cast<uint32_t>(hashFunction(key))) != this->tableSize;
+};
+
+// compact: Copies the live entries, slot by slot, into an arena of exactly the live size
+void StringArenaMap::compact() {
+    std::vector<char> live;
+    live.reserve(this->arena.size() - this->deadBytes);
+    for (Slot& slot : this->slots) {
+        if (slot.occupied) {
+            const char* bytes = this->arena.data() + slot.offset;
+            slot.offset = live.size();
+            live.insert(live.end(), bytes, bytes + slot.keyLength + slot.valueLength);
+        }
+    }
+    this->arena.swap(live);
+    this->deadBytes = 0;
+};
+
+void StringArenaMap::clear() {
+    std::vector<char>().swap(this->arena);
+    this->slots.assign(this->tableSize, Slot());
+    this->numElements = 0;
+    this->deadBytes = 0;
+};
+
+size_t StringArenaMap::getSize() const {
+    return this->numElements;
+};
+
+size_t StringArenaMap::getTableSize() const {
+    return this->tableSize;
+};
+
+size_t StringArenaMap::getArenaBytes() const {
+    return this->arena.size();
+};
+
+size_t StringArenaMap::getDeadBytes() const {
+    return this->deadBytes;
+};
+
+size_t StringArenaMap::getMemoryBytes() const {
+    return this->arena.capacity() + this->slots.capacity() * sizeof(Slot);
+};
+
+// print: Prints the occupied slots for debugging
+void StringArenaMap::print() const {
+    for (size_t i = 0; i < this->tableSize; i++) {
+        const Slot& slot = this->slots[i];
+        if (slot.occupied) {
+            const char* bytes = this->arena.data() + slot.offset;
+            std::cout << "Slot " << i << ": (" << std::string_view(bytes, slot.keyLength) << ", "
+                      << std::string_view(bytes + slot.keyLength, slot.valueLength) << ")" << std::endl;
+        }
+    }
+};
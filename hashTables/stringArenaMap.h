@@ -0,0 +1,104 @@
+#pragma once
+#include <cstddef>   // For size_t
+#include <cstdint>   // For uint32_t, uint64_t
+#include <string_view>
+#include <vector>
+#include "hashFunctions.h"
+
+// Map from strings to strings, laid out for millions of short entries.
+//
+// HashMap<std::string, std::string> pays for a list node, two std::string objects
+// and (past 15 characters) one heap block per string. Here the key and value bytes
+// of every entry are appended to one contiguous arena, and the table is a flat array
+// of 24-byte slots holding the entry's arena offset, both lengths and the cached
+// hash of the key. Collisions use linear probing; a lookup compares the cached hash
+// before touching the arena, and growing the table never rehashes a key.
+//
+// Removing an entry or replacing a value with a longer one leaves dead bytes in the
+// arena. Once they outweigh the live bytes the arena is compacted (compact() does it
+// on demand). The string_views returned by get/tryGet point into the arena: they stay
+// valid only until the next insert, insertOrAssign, remove or compact.
+class StringArenaMap {
+private:
+    struct Slot {
+        uint64_t offset;        // Start of the key bytes in the arena; the value bytes follow
+        uint32_t keyLength;
+        uint32_t valueLength;
+        uint32_t hash;          // Low 32 bits of the key's hash: the home slot and a cheap pre-check
+        uint32_t occupied;      // 1 if the slot holds an entry (fills what would be padding)
+    };
+
+    std::vector<char> arena;
+    std::vector<Slot> slots;
+    size_t tableSize;           // Always a power of two
+    size_t numElements;
+    size_t deadBytes;           // Arena bytes no longer referenced by any slot
+
+    const double MAX_LOAD_FACTOR = 0.8;
+    const size_t MIN_TABLE_SIZE = 16;
+    const size_t MIN_COMPACT_BYTES = 4096;   // Smaller arenas are never compacted automatically
+
+    static uint64_t hashFunction(std::string_view key);
+
+    // Index of the slot holding the key, or tableSize if it is absent
+    size_t findSlot(std::string_view key, uint32_t hash) const;
+
+    // Appends key and value bytes to the arena and returns the key's offset
+    uint64_t appendEntry(std::string_view key, std::string_view value);
+
+    // Whether the bytes of 'text' lie inside the arena (and could move when it grows)
+    bool pointsIntoArena(std::string_view text) const;
+
+    // Moves every slot into a table of 'newSize' slots using the cached hashes
+    void rehash(size_t newSize);
+
+    // Compacts the arena when the dead bytes outweigh the live ones
+    void compactIfWasteful();
+
+    // Stores a new entry whose key is known to be absent
+    void insertNew(std::string_view key, std::string_view value, uint32_t hash);
+
+public:
+    // Constructor: the requested number of slots is rounded up to a power of two
+    explicit StringArenaMap(size_t size = 16);
+
+    double getLoadFactor() const;
+
+    // insert: Adds the pair if the key is absent (an existing value is kept); returns
+    // true if it was added
+    bool insert(std::string_view key, std::string_view value);
+
+    // insertOrAssign: Adds the pair, or replaces the value of an existing key (in place
+    // when the new value is not longer); returns true if the key was new
+    bool insertOrAssign(std::string_view key, std::string_view value);
+
+    // remove: Removes the key, shifting the following probed entries back; returns false if absent
+    bool remove(std::string_view key);
+
+    // get: Returns the value of the key; throws std::out_of_range if not found
+    std::string_view get(std::string_view key) const;
+
+    // tryGet: Sets 'value' and returns true if the key is present
+    bool tryGet(std::string_view key, std::string_view& value) const;
+
+    bool contains(std::string_view key) const;
+
+    // compact: Rewrites the arena with only the live entries, freeing the dead bytes
+    void compact();
+
+    void clear();
+
+    size_t getSize() const;
+
+    size_t getTableSize() const;
+
+    // getArenaBytes: Bytes used in the arena, dead bytes included
+    size_t getArenaBytes() const;
+
+    size_t getDeadBytes() const;
+
+    // getMemoryBytes: Heap memory reserved by the arena and the slot array
+    size_t getMemoryBytes() const;
+
+    void print() const;
+};
@@ -0,0 +1,244 @@
+#include <cstddef>   // For size_t
+#include <cstdint>   // For int8_t, uint32_t, uint64_t
+#include <iostream>
+#include <vector>
+#include "swissHashSet.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SWISS_USE_SSE2 1
+#endif
+
+const size_t SwissHashSet::GROUP_WIDTH;
+const int8_t SwissHashSet::EMPTY;
+const int8_t SwissHashSet::DELETED;
+const size_t SwissHashSet::MIN_GROUPS;
+
+// Position of the lowest set bit (mask must not be 0)
+static inline unsigned lowestBit(uint32_t mask) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#else
+    unsigned bit = 0;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+// Hash function: every input bit affects both the tag and the group
+uint64_t SwissHashSet::hashFunction(const int& value) {
+    return IntHash()(value);
+}
+
+// Compares the 16 control bytes of a group with 'byte' in one instruction when SSE2 is available
+uint32_t SwissHashSet::matchByte(const int8_t* group, int8_t byte) {
+#ifdef SWISS_USE_SSE2
+    __m128i controlBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    __m128i matches = _mm_cmpeq_epi8(controlBytes, _mm_set1_epi8(byte));
+    return static_cast<uint32_t>(_mm_movemask_epi8(matches));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < GROUP_WIDTH; i++) {
+        if (group[i] == byte) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+// Walks the groups of the probe sequence (triangular steps visit every group once)
+// until the value is found or a group with an EMPTY slot proves it is absent.
+size_t SwissHashSet::findSlot(const int& value, uint64_t hash, size_t& probes) const {
+    int8_t tag = static_cast<int8_t>(hash & 0x7F);
+    size_t groupMask = this->numGroups - 1;
+    size_t group = (hash >> 7) & groupMask;
+
+    for (size_t step = 1; step <= this->numGroups; step++) {
+        probes = step;
+        const int8_t* groupControl = &this->control[group * GROUP_WIDTH];
+
+        uint32_t candidates = matchByte(groupControl, tag);
+        while (candidates != 0) {
+            size_t index = group * GROUP_WIDTH + lowestBit(candidates);
+            if (this->slots[index] == value) {
+                return index;
+            }
+            candidates &= candidates - 1;
+        }
+
+        // An EMPTY slot means the value was never pushed past this group
+        if (matchByte(groupControl, EMPTY) != 0) {
+            break;
+        }
+        group = (group + step) & groupMask;
+    }
+    return this->getTableSize();
+}
+
+// Index of the first EMPTY or DELETED slot on the probe sequence of 'hash'
+size_t SwissHashSet::findInsertSlot(uint64_t hash) const {
+    size_t groupMask = this->numGroups - 1;
+    size_t group = (hash >> 7) & groupMask;
+
+    for (size_t step = 1; ; step++) {
+        const int8_t* groupControl = &this->control[group * GROUP_WIDTH];
+        uint32_t available = matchByte(groupControl, EMPTY) | matchByte(groupControl, DELETED);
+        if (available != 0) {
+            return group * GROUP_WIDTH + lowestBit(available);
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+// Rebuilds the table with 'groups' groups, dropping tombstones
+void SwissHashSet::rehash(size_t groups) {
+    std::vector<int8_t> oldControl(groups * GROUP_WIDTH, EMPTY);
+    std::vector<int> oldSlots(groups * GROUP_WIDTH);
+    oldControl.swap(this->control);
+    oldSlots.swap(this->slots);
+    this->numGroups = groups;
+    this->numDeleted = 0;
+
+    for (size_t i = 0; i < oldControl.size(); i++) {
+        if (oldControl[i] >= 0) {   // Full slot
+            uint64_t hash = hashFunction(oldSlots[i]);
+            size_t index = this->findInsertSlot(hash);
+            this->control[index] = static_cast<int8_t>(hash & 0x7F);
+            this->slots[index] = oldSlots[i];
+        }
+    }
+}
+
+// Constructor: room for at least 'size' slots, rounded up to whole power-of-two groups
+SwissHashSet::SwissHashSet(size_t size) : numGroups(MIN_GROUPS), numElements(0), numDeleted(0) {
+    while (this->numGroups * GROUP_WIDTH < size) {
+        this->numGroups *= 2;
+    }
+    this->control.assign(this->numGroups * GROUP_WIDTH, EMPTY);
+    this->slots.assign(this->numGroups * GROUP_WIDTH, 0);
+}
+
+double SwissHashSet::getLoadFactor() const {
+    return static_cast<double>(this->numElements) / this->getTableSize();
+}
+
+// insert: Adds the value if it is not present yet. The hash is computed once
+// and reused for both the lookup and the placement.
+void SwissHashSet::insert(const int& value) {
+    uint64_t hash = hashFunction(value);
+    size_t probes;
+    if (this->findSlot(value, hash, probes) != this->getTableSize()) {
+        return;
+    }
+
+    if (static_cast<double>(this->numElements + this->numDeleted + 1) > this->getTableSize() * MAX_LOAD_FACTOR) {
+        // Mostly tombstones: clean up in place, otherwise grow
+        if (this->numDeleted > this->numElements) {
+            this->rehash(this->numGroups);
+        } else {
+            this->rehash(this->numGroups * 2);
+        }
+    }
+
+    size_t index = this->findInsertSlot(hash);
+    if (this->control[index] == DELETED) {
+        this->numDeleted--;
+    }
+    this->control[index] = static_cast<int8_t>(hash & 0x7F);
+    this->slots[index] = value;
+    this->numElements++;
+}
+
+// remove: Removes the value if present. If its group still has an EMPTY slot no
+// probe ever continued past the group, so the slot can become EMPTY again;
+// otherwise a DELETED tombstone keeps later probes going.
+void SwissHashSet::remove(const int& value) {
+    size_t probes;
+    size_t index = this->findSlot(value, hashFunction(value), probes);
+    if (index == this->getTableSize()) {
+        return;
+    }
+
+    const int8_t* groupControl = &this->control[(index / GROUP_WIDTH) * GROUP_WIDTH];
+    if (matchByte(groupControl, EMPTY) != 0) {
+        this->control[index] = EMPTY;
+    } else {
+        this->control[index] = DELETED;
+        this->numDeleted++;
+    }
+    this->numElements--;
+
+    if (this->numGroups > MIN_GROUPS && this->getLoadFactor() < MIN_LOAD_FACTOR) {
+        this->rehash(this->numGroups / 2);
+    }
+}
+
+// containsValue: Returns true if the value is in the set
+bool SwissHashSet::containsValue(const int& value) const {
+    size_t probes;
+    return this->findSlot(value, hashFunction(value), probes) != this->getTableSize();
+}
+
+// clear: Removes every value, keeping the current number of groups
+void SwissHashSet::clear() {
+    this->control.assign(this->control.size(), EMPTY);
+    this->numElements = 0;
+    this->numDeleted = 0;
+}
+
+size_t SwissHashSet::getSize() const {
+    return this->numElements;
+}
+
+size_t SwissHashSet::getTableSize() const {
+    return this->numGroups * GROUP_WIDTH;
+}
+
+// averageProbeLength: Mean number of groups a successful lookup inspects
+double SwissHashSet::averageProbeLength() const {
+    if (this->numElements == 0) {
+        return 0.0;
+    }
+
+    size_t total = 0;
+    for (size_t i = 0; i < this->control.size(); i++) {
+        if (this->control[i] >= 0) {
+            size_t probes = 0;
+            this->findSlot(this->slots[i], hashFunction(this->slots[i]), probes);
+            total += probes;
+        }
+    }
+    return static_cast<double>(total) / this->numElements;
+}
+
+// maxProbeLength: Largest number of groups any successful lookup inspects
+size_t SwissHashSet::maxProbeLength() const {
+    size_t longest = 0;
+    for (size_t i = 0; i < this->control.size(); i++) {
+        if (this->control[i] >= 0) {
+            size_t probes = 0;
+            this->findSlot(this->slots[i], hashFunction(this->slots[i]), probes);
+            if (probes > longest) {
+                longest = probes;
+            }
+        }
+    }
+    return longest;
+}
+
+// print: Prints the values of each group for debugging purposes
+void SwissHashSet::print() const {
+    for (size_t group = 0; group < this->numGroups; group++) {
+        std::cout << "Group " << group << ": ";
+        for (size_t i = group * GROUP_WIDTH; i < (group + 1) * GROUP_WIDTH; i++) {
+            if (this->control[i] >= 0) {
+                std::cout << this->slots[i] << " ";
+            }
+        }
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>   // For size_t
+#include <cstdint>   // For int8_t, uint32_t, uint64_t
+#include <vector>
+#include "hashFunctions.h"
+
+// Open-addressing set of ints in the style of Swiss tables.
+// Slots are organised in groups of 16, each with 16 control bytes: EMPTY,
+// DELETED, or the low 7 bits of the element's hash (its "tag"). A lookup loads
+// the 16 control bytes of a group at once and compares them with the tag in
+// parallel (SSE2 when available), so only slots whose tag matches are read.
+// A membership test usually touches one control line and one slot line.
+class SwissHashSet {
+private:
+    static const size_t GROUP_WIDTH = 16;
+    static const int8_t EMPTY = -128;    // 0b10000000
+    static const int8_t DELETED = -2;    // 0b11111110, tombstone left by remove
+                                         // Full slots hold a tag in 0..127
+    static const size_t MIN_GROUPS = 1;
+
+    std::vector<int8_t> control;  // One control byte per slot
+    std::vector<int> slots;       // Values, GROUP_WIDTH per group
+    size_t numGroups;             // Always a power of two
+    size_t numElements;
+    size_t numDeleted;            // Tombstones, they count towards the load when growing
+
+    const double MAX_LOAD_FACTOR = 0.875;
+    const double MIN_LOAD_FACTOR = 0.2;
+
+    // Hash function (IntHash): the low 7 bits are the tag, the remaining bits
+    // select the first group to probe
+    static uint64_t hashFunction(const int& value);
+
+    // Bit i set when control byte i of the group equals 'byte'
+    static uint32_t matchByte(const int8_t* group, int8_t byte);
+
+    // Index of the slot holding the value, or getTableSize() if it is absent.
+    // 'probes' receives the number of groups inspected.
+    size_t findSlot(const int& value, uint64_t hash, size_t& probes) const;
+
+    // Index of the first EMPTY or DELETED slot on the probe sequence of 'hash'
+    size_t findInsertSlot(uint64_t hash) const;
+
+    // Rebuilds the table with 'groups' groups, dropping tombstones
+    void rehash(size_t groups);
+
+public:
+    // Constructor: room for at least 'size' slots, rounded up to whole power-of-two groups
+    explicit SwissHashSet(size_t size = 101);
+
+    ~SwissHashSet() = default;
+
+    double getLoadFactor() const;
+
+    // insert: Adds the value if it is not present yet
+    void insert(const int& value);
+
+    // remove: Removes the value if present
+    void remove(const int& value);
+
+    // containsValue: Returns true if the value is in the set
+    bool containsValue(const int& value) const;
+
+    // clear: Removes every value, keeping the current number of groups
+    void clear();
+
+    // getSize: Returns the number of values stored
+    size_t getSize() const;
+
+    // getTableSize: Returns the number of slots
+    size_t getTableSize() const;
+
+    // averageProbeLength: Mean number of groups a successful lookup inspects
+    double averageProbeLength() const;
+
+    // maxProbeLength: Largest number of groups any successful lookup inspects
+    size_t maxProbeLength() const;
+
+    // print: Prints the values of each group for debugging purposes
+    void print() const;
+};
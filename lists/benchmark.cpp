@@ -0,0 +1,121 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "skipList.h"
+#include "lockFreeSkipList.h"
+
+// Small per-thread generator so the benchmark does not measure std::rand contention
+struct XorShift {
+    uint64_t state;
+
+    explicit XorShift(uint64_t seed) : state(seed * 0x9E3779B97F4A7C15ULL + 1) { }
+
+    uint64_t next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+// SkipList behind one mutex: the baseline a shared ordered index would use today
+struct LockedSkipList {
+    SkipList list;
+    std::mutex mutex;
+
+    bool insert(int key) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (list.contains(key)) return false;
+        list.insert(key);
+        return true;
+    }
+
+    bool remove(int key) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return list.remove(key);
+    }
+
+    bool contains(int key) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return list.contains(key);
+    }
+};
+
+// Runs 'threads' workers doing 'opsPerThread' operations each; returns millions of ops per second.
+// readPercent of the operations are lookups, the rest are split evenly between inserts and removes.
+template<typename Set>
+double runMix(Set& set, int threads, int readPercent, int keyRange, long opsPerThread) {
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&set, t, readPercent, keyRange, opsPerThread]() {
+            XorShift rng(t + 1);
+            for (long i = 0; i < opsPerThread; i++) {
+                uint64_t r = rng.next();
+                int key = static_cast<int>((r >> 16) % keyRange);
+                int op = static_cast<int>(r % 100);
+                if (op < readPercent) {
+                    set.contains(key);
+                } else if (op % 2 == 0) {
+                    set.insert(key);
+                } else {
+                    set.remove(key);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return (threads * opsPerThread) / elapsed.count() / 1e6;
+}
+
+// Fills half of the key range so inserts and removes both succeed about half the time
+template<typename Set>
+void prefill(Set& set, int keyRange) {
+    for (int key = 0; key < keyRange; key += 2) {
+        set.insert(key);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    // Usage: ./benchmark [keyRange] [opsPerThread] [maxThreads]
+    int keyRange = argc > 1 ? std::atoi(argv[1]) : 100000;
+    long opsPerThread = argc > 2 ? std::atol(argv[2]) : 500000;
+    int maxThreads = argc > 3 ? std::atoi(argv[3]) : static_cast<int>(std::thread::hardware_concurrency());
+    if (maxThreads < 1) maxThreads = 1;
+
+    std::cout << "Key range: " << keyRange << ", operations per thread: " << opsPerThread << std::endl;
+    std::cout << "Throughput in Mops/s (mutex-protected SkipList vs LockFreeSkipList)\n" << std::endl;
+
+    int readMixes[] = {90, 50, 10};
+    for (int readPercent : readMixes) {
+        std::cout << "--- " << readPercent << "% contains / " << (100 - readPercent) << "% insert+remove ---" << std::endl;
+        std::cout << std::setw(8) << "threads" << std::setw(14) << "locked" << std::setw(14) << "lock-free" << std::endl;
+
+        for (int threads = 1; threads <= maxThreads; threads *= 2) {
+            LockedSkipList locked;
+            prefill(locked, keyRange);
+            double lockedRate = runMix(locked, threads, readPercent, keyRange, opsPerThread);
+
+            LockFreeSkipList lockFree;
+            prefill(lockFree, keyRange);
+            double lockFreeRate = runMix(lockFree, threads, readPercent, keyRange, opsPerThread);
+
+            std::cout << std::setw(8) << threads
+                      << std::setw(14) << std::fixed << std::setprecision(2) << lockedRate
+                      << std::setw(14) << lockFreeRate << std::endl;
+        }
+        std::cout << std::endl;
+    }
+    return 0;
+}
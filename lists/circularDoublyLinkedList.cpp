@@ -2,6 +2,7 @@
 #include <stdexcept>
 #include <iostream>
 #include "circularDoublyLinkedList.h"
+#include "listMerge.h"
 
 // Constructor: initializes node data and sets pointers to nullptr
 DNode::DNode(int value) : data(value), next(nullptr), prev(nullptr) { };
@@ -225,3 +226,140 @@ void CircularDoublyLinkedList::print() const {
 
     std::cout << "\n";
 };
+
+// nodeAt: Returns the node at the specified index, walking from the closer end (index must be valid)
+DNode* CircularDoublyLinkedList::nodeAt(size_t index) const {
+    DNode* current = this->head;
+    if (index <= this->size / 2) {
+        for (size_t i = 0; i < index; i++) {
+            current = current->next;
+        }
+    } else {
+        for (size_t i = this->size; i > index; i--) {  // Walk backwards from the head through the tail
+            current = current->prev;
+        }
+    }
+    return current;
+};
+
+// linkChain: Links the chain first..last of 'count' nodes so that 'first' ends up at 'index'
+void CircularDoublyLinkedList::linkChain(size_t index, DNode* first, DNode* last, size_t count) {
+    if (this->size == 0) {                      // The chain becomes the whole ring
+        this->head = first;
+        first->prev = last;
+        last->next = first;
+    } else {
+        // Inserting at 'size' means inserting before the head, i.e. after the tail
+        DNode* nextNode = (index == this->size) ? this->head : this->nodeAt(index);
+        DNode* previousNode = nextNode->prev;
+
+        previousNode->next = first;
+        first->prev = previousNode;
+        last->next = nextNode;
+        nextNode->prev = last;
+
+        if (index == 0) {
+            this->head = first;
+        }
+    }
+    this->size += count;
+};
+
+// fixPrevLinks: Rebuilds 'prev' pointers and closes the ring after 'next'-only relinking
+void CircularDoublyLinkedList::fixPrevLinks() {
+    DNode* previousNode = nullptr;
+    DNode* current = this->head;
+    while (current != nullptr) {
+        current->prev = previousNode;
+        previousNode = current;
+        current = current->next;
+    }
+
+    // 'previousNode' is the tail: close the ring
+    previousNode->next = this->head;
+    this->head->prev = previousNode;
+};
+
+// splice: Moves every node of 'other' into this list so that they start at 'index'
+void CircularDoublyLinkedList::splice(size_t index, CircularDoublyLinkedList& other) {
+    if (&other == this) {
+        throw std::invalid_argument("Cannot splice a list into itself");
+    }
+    if (index > this->size) {
+        throw std::out_of_range("Index is out of bounds");
+    }
+    if (other.isEmpty()) {
+        return;
+    }
+
+    this->linkChain(index, other.head, other.head->prev, other.size);
+
+    other.head = nullptr;                       // 'other' no longer owns the nodes
+    other.size = 0;
+};
+
+// splice: Moves the nodes [first, last) of 'other' into this list so that they start at 'index'
+void CircularDoublyLinkedList::splice(size_t index, CircularDoublyLinkedList& other, size_t first, size_t last) {
+    if (&other == this) {
+        throw std::invalid_argument("Cannot splice a list into itself");
+    }
+    if (index > this->size || first > last || last > other.size) {
+        throw std::out_of_range("Index is out of bounds");
+    }
+    if (first == last) {
+        return;
+    }
+
+    size_t count = last - first;
+    DNode* firstNode = other.nodeAt(first);
+    DNode* lastNode = (count == 1) ? firstNode : other.nodeAt(last - 1);
+
+    // Detach the range from 'other'
+    if (count == other.size) {
+        other.head = nullptr;
+    } else {
+        firstNode->prev->next = lastNode->next;
+        lastNode->next->prev = firstNode->prev;
+        if (first == 0) {
+            other.head = lastNode->next;
+        }
+    }
+    other.size -= count;
+
+    this->linkChain(index, firstNode, lastNode, count);
+};
+
+// merge: Merges the sorted list 'other' into this sorted list, leaving 'other' empty
+void CircularDoublyLinkedList::merge(CircularDoublyLinkedList& other) {
+    if (&other == this || other.isEmpty()) {
+        return;
+    }
+    if (this->isEmpty()) {
+        this->splice(0, other);
+        return;
+    }
+
+    // Open both rings into nullptr-terminated chains, merge them, then close the result
+    this->head->prev->next = nullptr;
+    other.head->prev->next = nullptr;
+
+    DNode* newTail = nullptr;
+    this->head = mergeChains(this->head, other.head, newTail);
+    this->fixPrevLinks();
+    this->size += other.size;
+
+    other.head = nullptr;
+    other.size = 0;
+};
+
+// sort: Sorts the list in ascending order by relinking nodes
+void CircularDoublyLinkedList::sort() {
+    if (this->size < 2) {
+        return;
+    }
+
+    this->head->prev->next = nullptr;           // Open the ring
+    DNode* newTail = nullptr;
+    this->head = sortChain(this->head, this->size, newTail);
+    this->fixPrevLinks();
+};
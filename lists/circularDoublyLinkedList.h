@@ -20,6 +20,15 @@ private:
     DNode* head;     // Pointer to the head of the list
     size_t size;     // Current number of elements in the list
 
+    // nodeAt: Returns the node at the specified index, walking from the closer end (index must be valid)
+    DNode* nodeAt(size_t index) const;
+
+    // linkChain: Links the chain first..last of 'count' nodes so that 'first' ends up at 'index'
+    void linkChain(size_t index, DNode* first, DNode* last, size_t count);
+
+    // fixPrevLinks: Rebuilds 'prev' pointers and closes the ring after 'next'-only relinking
+    void fixPrevLinks();
+
 public:
     // Constructor: Initializes an empty circular doubly linked list
     CircularDoublyLinkedList();
@@ -66,6 +75,23 @@ public:
     // clear: Removes all elements from the list and frees memory
     void clear();
 
+    // splice: Moves every node of 'other' into this list so that they start at 'index'.
+    // Only pointers are relinked: O(1) at the front or back, otherwise O(min(index, size - index)).
+    // Throws an exception if the index is out of bounds or 'other' is this list.
+    void splice(size_t index, CircularDoublyLinkedList& other);
+
+    // splice: Moves the nodes [first, last) of 'other' into this list so that they start at 'index'.
+    // Throws an exception if either range is invalid or 'other' is this list.
+    void splice(size_t index, CircularDoublyLinkedList& other, size_t first, size_t last);
+
+    // merge: Merges the sorted list 'other' into this sorted list, leaving 'other' empty.
+    // Nodes are relinked, not copied; equal elements of this list stay first.
+    void merge(CircularDoublyLinkedList& other);
+
+    // sort: Sorts the list in ascending order with a bottom-up merge sort that relinks nodes
+    // (stable, O(n log n), no allocation).
+    void sort();
+
     // print: Traverses the list and prints its elements (for debugging/testing)
     void print() const;
 };
@@ -0,0 +1,155 @@
+#include <cstddef>    // For size_t
+#include <cstdint>    // For uint64_t
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#include "epochReclamation.h"
+
+// ThreadRecord constructor: starts unowned and outside any critical section
+EpochReclaimer::ThreadRecord::ThreadRecord() : localEpoch(0), inUse(false), nesting(0) { };
+
+// ThreadRegistration constructor: claims a free record for the calling thread
+EpochReclaimer::ThreadRegistration::ThreadRegistration() : record(nullptr) {
+    EpochReclaimer& reclaimer = EpochReclaimer::instance();
+    for (size_t i = 0; i < MAX_THREADS; i++) {
+        bool expected = false;
+        if (reclaimer.records[i].inUse.compare_exchange_strong(expected, true)) {
+            this->record = &reclaimer.records[i];
+            return;
+        }
+    }
+    throw std::runtime_error("Too many threads registered for epoch reclamation");
+};
+
+// ThreadRegistration destructor: hands pending nodes over and releases the record
+EpochReclaimer::ThreadRegistration::~ThreadRegistration() {
+    EpochReclaimer& reclaimer = EpochReclaimer::instance();
+    reclaimer.freeExpired(this->record->retired);
+
+    if (!this->record->retired.empty()) {
+        std::lock_guard<std::mutex> lock(reclaimer.orphanMutex);
+        reclaimer.orphans.insert(reclaimer.orphans.end(), this->record->retired.begin(), this->record->retired.end());
+    }
+    this->record->retired.clear();
+    this->record->nesting = 0;
+    this->record->localEpoch.store(0);
+    this->record->inUse.store(false);
+};
+
+// Constructor: the epoch starts at 1 because 0 marks inactive threads
+EpochReclaimer::EpochReclaimer() : globalEpoch(1) { };
+
+// instance: Returns the process-wide reclaimer
+EpochReclaimer& EpochReclaimer::instance() {
+    static EpochReclaimer reclaimer;
+    return reclaimer;
+};
+
+// Destructor: no thread is running anymore, so everything can be freed
+EpochReclaimer::~EpochReclaimer() {
+    for (size_t i = 0; i < MAX_THREADS; i++) {
+        for (const Retired& node : this->records[i].retired) {
+            node.deleter(node.object);
+        }
+        this->records[i].retired.clear();
+    }
+    for (const Retired& node : this->orphans) {
+        node.deleter(node.object);
+    }
+    this->orphans.clear();
+};
+
+// Returns the calling thread's record, registering the thread on first use
+EpochReclaimer::ThreadRecord* EpochReclaimer::localRecord() {
+    static thread_local ThreadRegistration registration;
+    return registration.record;
+};
+
+// Advances the global epoch if every active thread has announced the current one
+void EpochReclaimer::tryAdvance() {
+    uint64_t epoch = this->globalEpoch.load();
+    for (size_t i = 0; i < MAX_THREADS; i++) {
+        if (!this->records[i].inUse.load()) {
+            continue;
+        }
+        uint64_t announced = this->records[i].localEpoch.load();
+        if (announced != 0 && announced != epoch) {
+            return;  // Some reader is still in an older epoch
+        }
+    }
+    this->globalEpoch.compare_exchange_strong(epoch, epoch + 1);
+};
+
+// Frees the nodes of 'list' retired at least two epochs ago
+void EpochReclaimer::freeExpired(std::vector<Retired>& list) {
+    uint64_t epoch = this->globalEpoch.load();
+    size_t kept = 0;
+    for (size_t i = 0; i < list.size(); i++) {
+        if (list[i].epoch + 2 <= epoch) {
+            list[i].deleter(list[i].object);
+        } else {
+            list[kept++] = list[i];
+        }
+    }
+    list.resize(kept);
+};
+
+// enter: Announces the current epoch before any shared pointer is read
+void EpochReclaimer::enter() {
+    ThreadRecord* record = this->localRecord();
+    if (record->nesting++ > 0) {
+        return;
+    }
+
+    // Re-announce until the epoch did not move in between, so the announcement is never stale
+    uint64_t epoch = this->globalEpoch.load();
+    while (true) {
+        record->localEpoch.store(epoch);
+        uint64_t current = this->globalEpoch.load();
+        if (current == epoch) {
+            break;
+        }
+        epoch = current;
+    }
+};
+
+// exit: Leaves the critical section once the outermost guard ends
+void EpochReclaimer::exit() {
+    ThreadRecord* record = this->localRecord();
+    if (--record->nesting == 0) {
+        record->localEpoch.store(0, std::memory_order_release);
+    }
+};
+
+// retire: Queues the node on the calling thread and occasionally frees old ones
+void EpochReclaimer::retire(void* object, void (*deleter)(void*)) {
+    ThreadRecord* record = this->localRecord();
+    record->retired.push_back(Retired{object, deleter, this->globalEpoch.load()});
+
+    if (record->retired.size() >= COLLECT_THRESHOLD) {
+        this->collect();
+    }
+};
+
+// collect: Tries to advance the epoch and frees whatever became safe
+void EpochReclaimer::collect() {
+    this->tryAdvance();
+    this->freeExpired(this->localRecord()->retired);
+
+    // Orphans are rare, so a contended lock is simply skipped
+    std::unique_lock<std::mutex> lock(this->orphanMutex, std::try_to_lock);
+    if (lock.owns_lock() && !this->orphans.empty()) {
+        this->freeExpired(this->orphans);
+    }
+};
+
+// EpochGuard: enters a critical section on construction
+EpochGuard::EpochGuard() {
+    EpochReclaimer::instance().enter();
+};
+
+// EpochGuard: leaves it on destruction
+EpochGuard::~EpochGuard() {
+    EpochReclaimer::instance().exit();
+};
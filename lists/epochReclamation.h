@@ -0,0 +1,93 @@
+#pragma once
+#include <cstddef>    // For size_t
+#include <cstdint>    // For uint64_t
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// Epoch-based memory reclamation for lock-free structures.
+//
+// Readers announce the global epoch while they hold pointers into a shared
+// structure (see EpochGuard). Unlinked nodes are retired with the epoch they
+// were removed in and only freed once the global epoch has moved two steps
+// ahead, at which point no thread can still be holding them.
+class EpochReclaimer {
+private:
+    static const size_t MAX_THREADS = 256;        // Threads that can be registered at the same time
+    static const size_t COLLECT_THRESHOLD = 128;  // Retired nodes per thread before trying to free some
+
+    // A node waiting for every reader of its epoch to leave
+    struct Retired {
+        void* object;                 // The unlinked node
+        void (*deleter)(void*);       // Function that frees it
+        uint64_t epoch;               // Global epoch when it was retired
+    };
+
+    // Per-thread state, padded to its own cache line to avoid false sharing
+    struct alignas(64) ThreadRecord {
+        std::atomic<uint64_t> localEpoch;  // Announced epoch, 0 when outside a critical section
+        std::atomic<bool> inUse;           // Whether a live thread owns this record
+        unsigned nesting;                  // Depth of nested EpochGuards (owner thread only)
+        std::vector<Retired> retired;      // Nodes retired by the owner thread
+
+        ThreadRecord();
+    };
+
+    // Releases the calling thread's record when the thread exits
+    struct ThreadRegistration {
+        ThreadRecord* record;
+
+        ThreadRegistration();
+        ~ThreadRegistration();
+    };
+
+    std::atomic<uint64_t> globalEpoch;  // Starts at 1, 0 is reserved for "inactive"
+    ThreadRecord records[MAX_THREADS];
+
+    std::mutex orphanMutex;             // Guards 'orphans'
+    std::vector<Retired> orphans;       // Retired nodes left behind by exited threads
+
+    EpochReclaimer();
+
+    // Returns the calling thread's record, registering the thread on first use
+    ThreadRecord* localRecord();
+
+    // Advances the global epoch if every active thread has seen the current one
+    void tryAdvance();
+
+    // Frees the nodes of 'list' retired at least two epochs ago
+    void freeExpired(std::vector<Retired>& list);
+
+public:
+    // instance: Returns the process-wide reclaimer
+    static EpochReclaimer& instance();
+
+    // Destructor: Frees everything still waiting (runs at program exit)
+    ~EpochReclaimer();
+
+    EpochReclaimer(const EpochReclaimer&) = delete;
+    EpochReclaimer& operator=(const EpochReclaimer&) = delete;
+
+    // enter: Starts a critical section for the calling thread (may be nested)
+    void enter();
+
+    // exit: Ends the innermost critical section of the calling thread
+    void exit();
+
+    // retire: Schedules 'object' to be freed with 'deleter' once no reader can reach it.
+    // The object must already be unlinked from the shared structure.
+    void retire(void* object, void (*deleter)(void*));
+
+    // collect: Tries to advance the epoch and frees whatever became safe
+    void collect();
+};
+
+// RAII critical section: pointers read from a shared structure stay valid while it lives
+class EpochGuard {
+public:
+    EpochGuard();
+    ~EpochGuard();
+
+    EpochGuard(const EpochGuard&) = delete;
+    EpochGuard& operator=(const EpochGuard&) = delete;
+};
@@ -0,0 +1,331 @@
+#include <cstddef>    // For size_t
+#include <cstdint>    // For uint32_t, UINT32_MAX
+#include <stdexcept>
+#include <iostream>
+#include <vector>
+#include "indexLinkedList.h"
+#include "listMerge.h"
+
+// Constructor: Initializes an empty list (the pool is created on the first insertion)
+IndexLinkedList::IndexLinkedList() : head(0), freeList(0), size(0) { };
+
+// allocateNode: Takes a free slot (or grows the pool) and stores the value in it
+uint32_t IndexLinkedList::allocateNode(int value) {
+    uint32_t index;
+    if (this->freeList != 0) {                               // Reuse a released slot
+        index = this->freeList;
+        this->freeList = this->nodes[index].next;
+    } else {
+        if (this->nodes.empty()) {
+            this->nodes.push_back(IndexNode{0, 0, 0});       // Reserved slot 0, never holds data
+        }
+        if (this->nodes.size() == UINT32_MAX) {
+            throw std::length_error("List is full");
+        }
+        index = static_cast<uint32_t>(this->nodes.size());
+        this->nodes.push_back(IndexNode{0, 0, 0});
+    }
+
+    this->nodes[index].data = value;
+    this->nodes[index].next = index;                         // A lone node is a ring of one
+    this->nodes[index].prev = index;
+    return index;
+};
+
+// releaseNode: Returns a slot to the free list
+void IndexLinkedList::releaseNode(uint32_t index) {
+    this->nodes[index].next = this->freeList;
+    this->freeList = index;
+};
+
+// nodeAt: Returns the pool index of the element at 'index', walking from the closer end
+uint32_t IndexLinkedList::nodeAt(size_t index) const {
+    uint32_t current = this->head;
+    if (index <= this->size / 2) {
+        for (size_t i = 0; i < index; i++) {
+            current = this->nodes[current].next;
+        }
+    } else {
+        for (size_t i = this->size; i > index; i--) {
+            current = this->nodes[current].prev;
+        }
+    }
+    return current;
+};
+
+// unlink: Detaches a node from the ring and releases it
+void IndexLinkedList::unlink(uint32_t node) {
+    if (this->size > 1) {
+        uint32_t previousNode = this->nodes[node].prev;
+        uint32_t nextNode = this->nodes[node].next;
+        this->nodes[previousNode].next = nextNode;
+        this->nodes[nextNode].prev = previousNode;
+        if (node == this->head) {
+            this->head = nextNode;
+        }
+    } else {
+        this->head = 0;
+    }
+
+    this->releaseNode(node);
+    this->size--;
+};
+
+// copyChain: Copies 'count' elements of 'source' into new slots of this pool, linked in order
+uint32_t IndexLinkedList::copyChain(const IndexLinkedList& source, uint32_t from, size_t count, uint32_t& last) {
+    uint32_t first = 0;
+    last = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t copy = this->allocateNode(source.nodes[from].data);
+        this->nodes[copy].prev = last;
+        this->nodes[copy].next = 0;
+        if (last != 0) {
+            this->nodes[last].next = copy;
+        } else {
+            first = copy;
+        }
+        last = copy;
+        from = source.nodes[from].next;
+    }
+    return first;
+};
+
+// linkChain: Links the chain first..last of 'count' nodes so that 'first' ends up at 'index'
+void IndexLinkedList::linkChain(size_t index, uint32_t first, uint32_t last, size_t count) {
+    if (this->size == 0) {                      // The chain becomes the whole ring
+        this->head = first;
+        this->nodes[first].prev = last;
+        this->nodes[last].next = first;
+    } else {
+        // Inserting at 'size' means inserting before the head, i.e. after the tail
+        uint32_t nextNode = (index == this->size) ? this->head : this->nodeAt(index);
+        uint32_t previousNode = this->nodes[nextNode].prev;
+
+        this->nodes[previousNode].next = first;
+        this->nodes[first].prev = previousNode;
+        this->nodes[last].next = nextNode;
+        this->nodes[nextNode].prev = last;
+
+        if (index == 0) {
+            this->head = first;
+        }
+    }
+    this->size += count;
+};
+
+// fixPrevLinks: Rebuilds 'prev' links and closes the ring after 'next'-only relinking
+void IndexLinkedList::fixPrevLinks() {
+    uint32_t previousNode = 0;
+    uint32_t current = this->head;
+    while (current != 0) {
+        this->nodes[current].prev = previousNode;
+        previousNode = current;
+        current = this->nodes[current].next;
+    }
+
+    // 'previousNode' is the tail: close the ring
+    this->nodes[previousNode].next = this->head;
+    this->nodes[this->head].prev = previousNode;
+};
+
+// push_front: Inserts an element at the beginning of the list
+void IndexLinkedList::push_front(int value) {
+    this->insert(0, value);
+};
+
+// push_back: Inserts an element at the end of the list
+void IndexLinkedList::push_back(int value) {
+    this->insert(this->size, value);
+};
+
+// insert: Inserts an element at the specified index (0-indexed)
+// Throws an exception if the index is out of bounds.
+void IndexLinkedList::insert(size_t index, int value) {
+    if (index > this->size) {
+        throw std::out_of_range("Index is out of bounds");
+    }
+
+    uint32_t newNode = this->allocateNode(value);
+    if (this->size > 0) {
+        // Inserting at 'size' means inserting before the head, i.e. after the tail
+        uint32_t nextNode = (index == this->size) ? this->head : this->nodeAt(index);
+        uint32_t previousNode = this->nodes[nextNode].prev;
+
+        this->nodes[newNode].prev = previousNode;
+        this->nodes[newNode].next = nextNode;
+        this->nodes[previousNode].next = newNode;
+        this->nodes[nextNode].prev = newNode;
+
+        if (index == 0) {
+            this->head = newNode;
+        }
+    } else {
+        this->head = newNode;
+    }
+    this->size++;
+};
+
+// pop_front: Removes the element at the beginning of the list
+// Throws an exception if the list is empty.
+void IndexLinkedList::pop_front() {
+    if (this->isEmpty()) {
+        throw std::out_of_range("List is empty");
+    }
+    this->unlink(this->head);
+};
+
+// pop_back: Removes the element at the end of the list
+// Throws an exception if the list is empty.
+void IndexLinkedList::pop_back() {
+    if (this->isEmpty()) {
+        throw std::out_of_range("List is empty");
+    }
+    this->unlink(this->nodes[this->head].prev);
+};
+
+// remove: Removes the element at the specified index (0-indexed)
+// Throws an exception if the index is invalid.
+void IndexLinkedList::remove(size_t index) {
+    if (index >= this->size) {
+        throw std::out_of_range("Index is out of bounds");
+    }
+    this->unlink(this->nodeAt(index));
+};
+
+// front: Returns a reference to the first element
+// Throws an exception if the list is empty.
+int& IndexLinkedList::front() {
+    if (this->isEmpty()) {
+        throw std::out_of_range("List is empty");
+    }
+    return this->nodes[this->head].data;
+};
+
+// back: Returns a reference to the last element
+// Throws an exception if the list is empty.
+int& IndexLinkedList::back() {
+    if (this->isEmpty()) {
+        throw std::out_of_range("List is empty");
+    }
+    return this->nodes[this->nodes[this->head].prev].data;
+};
+
+// getSize: Returns the current number of elements in the list
+size_t IndexLinkedList::getSize() const {
+    return this->size;
+};
+
+// isEmpty: Checks if the list is empty
+bool IndexLinkedList::isEmpty() const {
+    return !this->size;
+};
+
+// clear: Removes all elements from the list and frees the pool
+void IndexLinkedList::clear() {
+    std::vector<IndexNode>().swap(this->nodes);
+    this->head = this->freeList = 0;
+    this->size = 0;
+};
+
+// splice: Moves every element of 'other' into this list so that they start at 'index'
+void IndexLinkedList::splice(size_t index, IndexLinkedList& other) {
+    if (&other == this) {
+        throw std::invalid_argument("Cannot splice a list into itself");
+    }
+    if (index > this->size) {
+        throw std::out_of_range("Index is out of bounds");
+    }
+    if (other.isEmpty()) {
+        return;
+    }
+
+    uint32_t last;
+    uint32_t first = this->copyChain(other, other.head, other.size, last);
+    this->linkChain(index, first, last, other.size);
+    other.clear();
+};
+
+// splice: Moves the elements [first, last) of 'other' into this list so that they start at 'index'
+void IndexLinkedList::splice(size_t index, IndexLinkedList& other, size_t first, size_t last) {
+    if (&other == this) {
+        throw std::invalid_argument("Cannot splice a list into itself");
+    }
+    if (index > this->size || first > last || last > other.size) {
+        throw std::out_of_range("Index is out of bounds");
+    }
+    if (first == last) {
+        return;
+    }
+
+    size_t count = last - first;
+    uint32_t firstNode = other.nodeAt(first);
+    uint32_t chainLast;
+    uint32_t chainFirst = this->copyChain(other, firstNode, count, chainLast);
+
+    // Release the range in 'other', front to back
+    uint32_t current = firstNode;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t nextNode = other.nodes[current].next;
+        other.unlink(current);
+        current = nextNode;
+    }
+
+    this->linkChain(index, chainFirst, chainLast, count);
+};
+
+// merge: Merges the sorted list 'other' into this sorted list, leaving 'other' empty
+void IndexLinkedList::merge(IndexLinkedList& other) {
+    if (&other == this || other.isEmpty()) {
+        return;
+    }
+    if (this->isEmpty()) {
+        this->splice(0, other);
+        return;
+    }
+
+    uint32_t otherLast;
+    uint32_t otherFirst = this->copyChain(other, other.head, other.size, otherLast);
+
+    // Open this ring into a chain ending in 0, merge, then close the result
+    this->nodes[this->nodes[this->head].prev].next = 0;
+    uint32_t newTail = 0;
+    this->head = mergeIndexChains(this->nodes, &IndexNode::next, this->head, otherFirst, newTail);
+    this->fixPrevLinks();
+    this->size += other.size;
+    other.clear();
+};
+
+// sort: Sorts the list in ascending order by relinking indices
+void IndexLinkedList::sort() {
+    if (this->size < 2) {
+        return;
+    }
+
+    this->nodes[this->nodes[this->head].prev].next = 0;     // Open the ring
+    uint32_t newTail = 0;
+    this->head = sortIndexChain(this->nodes, &IndexNode::next, this->head, this->size, newTail);
+    this->fixPrevLinks();
+};
+
+// memoryUsage: Returns the bytes reserved by the node pool
+size_t IndexLinkedList::memoryUsage() const {
+    return this->nodes.capacity() * sizeof(IndexNode);
+};
+
+// print: Traverses the list and prints its elements (for debugging/testing)
+void IndexLinkedList::print() const {
+    if (this->isEmpty()) {
+        std::cout << "List is empty" << std::endl;
+        return;
+    }
+
+    uint32_t current = this->head;
+    do {
+        std::cout << this->nodes[current].data;
+        current = this->nodes[current].next;
+        if (current != this->head) {
+            std::cout << " -> ";
+        }
+    } while (current != this->head);
+    std::cout << "\n";
+};
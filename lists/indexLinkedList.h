@@ -0,0 +1,118 @@
+#pragma once
+#include <cstddef>    // For size_t
+#include <cstdint>    // For uint32_t
+#include <stdexcept>
+#include <vector>
+
+// Node structure for the index-linked list: 12 bytes instead of the 24 of a DNode,
+// because neighbours are 32-bit positions in a pool instead of 64-bit pointers.
+struct IndexNode {
+    int data;        // Data stored in the node
+    uint32_t next;   // Index of the next node in the pool
+    uint32_t prev;   // Index of the previous node in the pool
+};
+
+// Circular doubly linked list whose nodes live in one pooled array and link to each
+// other by 32-bit index. Exposes the same operations as CircularDoublyLinkedList.
+class IndexLinkedList {
+private:
+    std::vector<IndexNode> nodes;  // Node pool; slot 0 is reserved so that index 0 can mean "no node"
+    uint32_t head;                 // Index of the first node (0 if empty); nodes[head].prev is the tail
+    uint32_t freeList;             // First free slot, free slots are chained through 'next'
+    size_t size;                   // Current number of elements in the list
+
+    // allocateNode: Takes a free slot (or grows the pool) and stores the value in it
+    uint32_t allocateNode(int value);
+
+    // releaseNode: Returns a slot to the free list
+    void releaseNode(uint32_t index);
+
+    // nodeAt: Returns the pool index of the element at 'index', walking from the closer end
+    uint32_t nodeAt(size_t index) const;
+
+    // unlink: Detaches a node from the ring and releases it
+    void unlink(uint32_t node);
+
+    // copyChain: Copies 'count' elements of 'source', starting at its pool index 'from',
+    // into new slots of this pool. Returns the first new slot and stores the last in
+    // 'last'; the copies are linked in order through 'next' (ending in 0) and 'prev'.
+    uint32_t copyChain(const IndexLinkedList& source, uint32_t from, size_t count, uint32_t& last);
+
+    // linkChain: Links the chain first..last of 'count' nodes so that 'first' ends up at 'index'
+    void linkChain(size_t index, uint32_t first, uint32_t last, size_t count);
+
+    // fixPrevLinks: Rebuilds 'prev' links and closes the ring after 'next'-only relinking
+    void fixPrevLinks();
+
+public:
+    // Constructor: Initializes an empty list
+    IndexLinkedList();
+
+    // Destructor: The pool is released with the vector
+    ~IndexLinkedList() = default;
+
+    // push_front: Inserts an element at the beginning of the list
+    void push_front(int value);
+
+    // push_back: Inserts an element at the end of the list
+    void push_back(int value);
+
+    // insert: Inserts an element at the specified index (0-indexed)
+    // Throws an exception if the index is out of bounds.
+    void insert(size_t index, int value);
+
+    // pop_front: Removes the element at the beginning of the list
+    // Throws an exception if the list is empty.
+    void pop_front();
+
+    // pop_back: Removes the element at the end of the list
+    // Throws an exception if the list is empty.
+    void pop_back();
+
+    // remove: Removes the element at the specified index (0-indexed)
+    // Throws an exception if the index is invalid.
+    void remove(size_t index);
+
+    // front: Returns a reference to the first element
+    // Throws an exception if the list is empty.
+    int& front();
+
+    // back: Returns a reference to the last element
+    // Throws an exception if the list is empty.
+    int& back();
+
+    // getSize: Returns the current number of elements in the list
+    size_t getSize() const;
+
+    // isEmpty: Checks if the list is empty
+    bool isEmpty() const;
+
+    // clear: Removes all elements from the list and frees the pool
+    void clear();
+
+    // splice: Moves every element of 'other' into this list so that they start at 'index'.
+    // Each list has its own pool, so the elements are copied into free slots of this one
+    // and 'other' is cleared: O(size of other), plus O(min(index, size - index)) to find
+    // the position. Throws an exception if the index is out of bounds or 'other' is this list.
+    void splice(size_t index, IndexLinkedList& other);
+
+    // splice: Moves the elements [first, last) of 'other' into this list so that they start
+    // at 'index' (copied, as above; their slots in 'other' are released).
+    // Throws an exception if either range is invalid or 'other' is this list.
+    void splice(size_t index, IndexLinkedList& other, size_t first, size_t last);
+
+    // merge: Merges the sorted list 'other' into this sorted list, leaving 'other' empty.
+    // The elements of 'other' are copied into this pool, then the nodes are merged by
+    // relinking indices; equal elements of this list stay first.
+    void merge(IndexLinkedList& other);
+
+    // sort: Sorts the list in ascending order with a bottom-up merge sort that relinks
+    // indices within the pool (stable, O(n log n), no allocation).
+    void sort();
+
+    // memoryUsage: Returns the bytes reserved by the node pool
+    size_t memoryUsage() const;
+
+    // print: Traverses the list and prints its elements (for debugging/testing)
+    void print() const;
+};
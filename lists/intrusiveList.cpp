@@ -0,0 +1,163 @@
+#include <cstddef>    // For size_t
+#include <stdexcept>
+#include "intrusiveList.h"
+
+// Constructor: a new hook is not linked anywhere
+ListHook::ListHook() : next(nullptr), prev(nullptr) { };
+
+// Copy constructor: the copy is a different object, so it starts unlinked
+ListHook::ListHook(const ListHook&) : next(nullptr), prev(nullptr) { };
+
+// Copy assignment: keeps this object's own links untouched
+ListHook& ListHook::operator=(const ListHook&) {
+    return *this;
+};
+
+// isLinked: Returns true if the hook currently belongs to a list
+bool ListHook::isLinked() const {
+    return this->next != nullptr;
+};
+
+// Constructor: Initializes an empty list
+IntrusiveList::IntrusiveList() : head(nullptr), size(0) { };
+
+// Destructor: Unlinks every hook so the objects can be linked elsewhere later
+IntrusiveList::~IntrusiveList() {
+    this->clear();
+};
+
+// linkBefore: Links 'node' right before 'position' in the ring
+void IntrusiveList::linkBefore(ListHook& position, ListHook& node) {
+    node.next = &position;
+    node.prev = position.prev;
+    position.prev->next = &node;
+    position.prev = &node;
+};
+
+// push_front: Links the hook at the beginning of the list
+void IntrusiveList::push_front(ListHook& node) {
+    this->push_back(node);
+    this->head = &node;          // In a ring, the new back followed by a head shift is the new front
+};
+
+// push_back: Links the hook at the end of the list
+void IntrusiveList::push_back(ListHook& node) {
+    if (node.isLinked()) {
+        throw std::invalid_argument("Node is already linked");
+    }
+
+    if (this->size > 0) {
+        this->linkBefore(*this->head, node);   // Before the head is the back of the ring
+    } else {
+        node.next = &node;                     // A single hook points to itself both ways
+        node.prev = &node;
+        this->head = &node;
+    }
+    this->size++;
+};
+
+// pop_front: Unlinks and returns the first hook
+ListHook& IntrusiveList::pop_front() {
+    ListHook& node = this->front();
+    this->unlink(node);
+    return node;
+};
+
+// pop_back: Unlinks and returns the last hook
+ListHook& IntrusiveList::pop_back() {
+    ListHook& node = this->back();
+    this->unlink(node);
+    return node;
+};
+
+// unlink: Removes a hook of this list in O(1)
+void IntrusiveList::unlink(ListHook& node) {
+    if (!node.isLinked()) {
+        throw std::invalid_argument("Node is not linked");
+    }
+
+    if (this->size > 1) {
+        node.prev->next = node.next;
+        node.next->prev = node.prev;
+        if (this->head == &node) {
+            this->head = node.next;
+        }
+    } else {
+        this->head = nullptr;
+    }
+
+    node.next = nullptr;
+    node.prev = nullptr;
+    this->size--;
+};
+
+// moveToFront: Makes a hook of this list the first one in O(1)
+void IntrusiveList::moveToFront(ListHook& node) {
+    if (!node.isLinked()) {
+        throw std::invalid_argument("Node is not linked");
+    }
+    if (this->head == &node) {
+        return;
+    }
+    if (this->head->prev == &node) {
+        this->head = &node;      // The back becomes the front by rotating the ring, no relinking needed
+        return;
+    }
+
+    // Detach and relink before the current head
+    node.prev->next = node.next;
+    node.next->prev = node.prev;
+    this->linkBefore(*this->head, node);
+    this->head = &node;
+};
+
+// moveToBack: Makes a hook of this list the last one in O(1)
+void IntrusiveList::moveToBack(ListHook& node) {
+    if (!node.isLinked()) {
+        throw std::invalid_argument("Node is not linked");
+    }
+    if (this->head->prev == &node) {
+        return;
+    }
+    if (this->head == &node) {
+        this->head = node.next;  // The front becomes the back by rotating the ring
+        return;
+    }
+
+    node.prev->next = node.next;
+    node.next->prev = node.prev;
+    this->linkBefore(*this->head, node);
+};
+
+// front: Returns the first hook
+ListHook& IntrusiveList::front() {
+    if (this->isEmpty()) {
+        throw std::out_of_range("List is empty");
+    }
+    return *this->head;
+};
+
+// back: Returns the last hook
+ListHook& IntrusiveList::back() {
+    if (this->isEmpty()) {
+        throw std::out_of_range("List is empty");
+    }
+    return *this->head->prev;
+};
+
+// getSize: Returns the current number of linked hooks
+size_t IntrusiveList::getSize() const {
+    return this->size;
+};
+
+// isEmpty: Checks if the list is empty
+bool IntrusiveList::isEmpty() const {
+    return !this->size;
+};
+
+// clear: Unlinks every hook (the objects themselves are untouched)
+void IntrusiveList::clear() {
+    while (this->size > 0) {
+        this->unlink(*this->head);
+    }
+};
@@ -0,0 +1,92 @@
+#pragma once
+#include <cstddef>    // For size_t
+#include <stdexcept>
+
+// Hook embedded in user objects so they can be linked into an IntrusiveList
+// without allocating a node. Objects inherit from it:
+//
+//     struct CacheEntry : ListHook { int key; std::string value; };
+//
+// and are recovered from a hook with static_cast<CacheEntry&>(hook).
+struct ListHook {
+    ListHook* next;   // Next hook in the ring (nullptr when not linked)
+    ListHook* prev;   // Previous hook in the ring (nullptr when not linked)
+
+    // Constructor: a new hook is not linked anywhere
+    ListHook();
+
+    // Copies start unlinked: links belong to the original object's position
+    ListHook(const ListHook&);
+    ListHook& operator=(const ListHook&);
+
+    // isLinked: Returns true if the hook currently belongs to a list
+    bool isLinked() const;
+};
+
+// Circular doubly linked list of hooks that never allocates or frees memory.
+// Same front/back semantics as CircularDoublyLinkedList: head->prev is the back.
+// The list does not own the objects; they must outlive their membership, and a
+// hook can only be in one list at a time.
+class IntrusiveList {
+private:
+    ListHook* head;   // First hook of the ring
+    size_t size;      // Current number of linked hooks
+
+    // linkBefore: Links 'node' right before 'position' in the ring
+    void linkBefore(ListHook& position, ListHook& node);
+
+public:
+    // Constructor: Initializes an empty list
+    IntrusiveList();
+
+    // Destructor: Unlinks every hook (the objects themselves are untouched)
+    ~IntrusiveList();
+
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    // push_front: Links the hook at the beginning of the list
+    // Throws an exception if the hook is already linked.
+    void push_front(ListHook& node);
+
+    // push_back: Links the hook at the end of the list
+    // Throws an exception if the hook is already linked.
+    void push_back(ListHook& node);
+
+    // pop_front: Unlinks and returns the first hook
+    // Throws an exception if the list is empty.
+    ListHook& pop_front();
+
+    // pop_back: Unlinks and returns the last hook
+    // Throws an exception if the list is empty.
+    ListHook& pop_back();
+
+    // unlink: Removes a hook of this list in O(1)
+    // Throws an exception if the hook is not linked.
+    void unlink(ListHook& node);
+
+    // moveToFront: Makes a hook of this list the first one in O(1)
+    // Throws an exception if the hook is not linked.
+    void moveToFront(ListHook& node);
+
+    // moveToBack: Makes a hook of this list the last one in O(1)
+    // Throws an exception if the hook is not linked.
+    void moveToBack(ListHook& node);
+
+    // front: Returns the first hook
+    // Throws an exception if the list is empty.
+    ListHook& front();
+
+    // back: Returns the last hook
+    // Throws an exception if the list is empty.
+    ListHook& back();
+
+    // getSize: Returns the current number of linked hooks
+    size_t getSize() const;
+
+    // isEmpty: Checks if the list is empty
+    bool isEmpty() const;
+
+    // clear: Unlinks every hook (the objects themselves are untouched)
+    void clear();
+};
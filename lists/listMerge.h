@@ -0,0 +1,181 @@
+#pragma once
+#include <cstddef>    // For size_t
+#include <cstdint>    // For uint32_t
+#include <vector>
+
+// Helpers shared by the linked lists to merge and sort nodes in place.
+// They work on nullptr-terminated chains linked through 'next' and only rewrite
+// 'next' pointers, so no node is allocated or copied. Doubly linked lists fix
+// their 'prev' pointers afterwards.
+
+// splitChain: Cuts the chain after its first 'count' nodes and returns the rest (or nullptr)
+template<typename NodeType>
+NodeType* splitChain(NodeType* head, size_t count) {
+    for (size_t i = 1; head != nullptr && i < count; i++) {
+        head = head->next;
+    }
+    if (head == nullptr) {
+        return nullptr;
+    }
+
+    NodeType* rest = head->next;
+    head->next = nullptr;
+    return rest;
+}
+
+// mergeChains: Merges two sorted chains, keeping equal elements of 'first' before those of 'second'.
+// Returns the merged head and stores its last node in 'tail'.
+template<typename NodeType>
+NodeType* mergeChains(NodeType* first, NodeType* second, NodeType*& tail) {
+    NodeType* head = nullptr;
+    NodeType** link = &head;  // Slot where the next chosen node is attached
+    tail = nullptr;
+
+    while (first != nullptr && second != nullptr) {
+        if (second->data < first->data) {
+            tail = second;
+            second = second->next;
+        } else {
+            tail = first;
+            first = first->next;
+        }
+        *link = tail;
+        link = &tail->next;
+    }
+
+    // Append whatever is left and walk to its end for the new tail
+    *link = (first != nullptr) ? first : second;
+    if (*link != nullptr) {
+        tail = *link;
+        while (tail->next != nullptr) {
+            tail = tail->next;
+        }
+    }
+    return head;
+}
+
+// sortChain: Bottom-up merge sort of a chain of 'length' nodes (stable, O(n log n), O(1) extra memory).
+// Returns the new head and stores the last node in 'tail'.
+template<typename NodeType>
+NodeType* sortChain(NodeType* head, size_t length, NodeType*& tail) {
+    tail = head;
+    for (size_t width = 1; width < length; width *= 2) {
+        NodeType* remaining = head;
+        NodeType* sortedHead = nullptr;
+        NodeType* sortedTail = nullptr;
+
+        // Merge consecutive pairs of runs of 'width' nodes
+        while (remaining != nullptr) {
+            NodeType* left = remaining;
+            NodeType* right = splitChain(left, width);
+            remaining = splitChain(right, width);
+
+            NodeType* mergedTail = nullptr;
+            NodeType* merged = mergeChains(left, right, mergedTail);
+            if (sortedTail != nullptr) {
+                sortedTail->next = merged;
+            } else {
+                sortedHead = merged;
+            }
+            sortedTail = mergedTail;
+        }
+
+        head = sortedHead;
+        tail = sortedTail;
+    }
+    return head;
+}
+
+// Index-linked variants for the pooled lists (IndexLinkedList, XorLinkedList). A chain
+// is a sequence of pool indices linked through the member 'next' and ended by index 0,
+// which every pool reserves. Only that member is rewritten; the lists rebuild their
+// other links afterwards.
+
+// splitIndexChain: Cuts the chain after its first 'count' nodes and returns the rest (or 0)
+template<typename NodeType>
+uint32_t splitIndexChain(std::vector<NodeType>& nodes, uint32_t NodeType::*next, uint32_t head, size_t count) {
+    for (size_t i = 1; head != 0 && i < count; i++) {
+        head = nodes[head].*next;
+    }
+    if (head == 0) {
+        return 0;
+    }
+
+    uint32_t rest = nodes[head].*next;
+    nodes[head].*next = 0;
+    return rest;
+}
+
+// mergeIndexChains: Merges two sorted chains, keeping equal elements of 'first' before those of 'second'.
+// Returns the merged head and stores its last node in 'tail'.
+template<typename NodeType>
+uint32_t mergeIndexChains(std::vector<NodeType>& nodes, uint32_t NodeType::*next,
+                          uint32_t first, uint32_t second, uint32_t& tail) {
+    uint32_t head = 0;
+    tail = 0;
+
+    while (first != 0 && second != 0) {
+        uint32_t chosen;
+        if (nodes[second].data < nodes[first].data) {
+            chosen = second;
+            second = nodes[second].*next;
+        } else {
+            chosen = first;
+            first = nodes[first].*next;
+        }
+        if (tail != 0) {
+            nodes[tail].*next = chosen;
+        } else {
+            head = chosen;
+        }
+        tail = chosen;
+    }
+
+    // Append whatever is left and walk to its end for the new tail
+    uint32_t rest = (first != 0) ? first : second;
+    if (tail != 0) {
+        nodes[tail].*next = rest;
+    } else {
+        head = rest;
+    }
+    if (rest != 0) {
+        tail = rest;
+        while (nodes[tail].*next != 0) {
+            tail = nodes[tail].*next;
+        }
+    }
+    return head;
+}
+
+// sortIndexChain: Bottom-up merge sort of a chain of 'length' nodes (stable, O(n log n), O(1) extra memory).
+// Returns the new head and stores the last node in 'tail'.
+template<typename NodeType>
+uint32_t sortIndexChain(std::vector<NodeType>& nodes, uint32_t NodeType::*next,
+                        uint32_t head, size_t length, uint32_t& tail) {
+    tail = head;
+    for (size_t width = 1; width < length; width *= 2) {
+        uint32_t remaining = head;
+        uint32_t sortedHead = 0;
+        uint32_t sortedTail = 0;
+
+        // Merge consecutive pairs of runs of 'width' nodes
+        while (remaining != 0) {
+            uint32_t left = remaining;
+            uint32_t right = splitIndexChain(nodes, next, left, width);
+            remaining = splitIndexChain(nodes, next, right, width);
+
+            uint32_t mergedTail = 0;
+            uint32_t merged = mergeIndexChains(nodes, next, left, right, mergedTail);
+            if (sortedTail != 0) {
+                nodes[sortedTail].*next = merged;
+            } else {
+                sortedHead = merged;
+            }
+            sortedTail = mergedTail;
+        }
+
+        head = sortedHead;
+        tail = sortedTail;
+    }
+    return head;
+}
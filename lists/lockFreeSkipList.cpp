@@ -0,0 +1,349 @@
+#include <cstddef>    // For size_t
+#include <cstdint>    // For uintptr_t, uint64_t
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "epochReclamation.h"
+#include "lockFreeSkipList.h"
+
+// Helpers for the marked pointers stored in LockFreeSkipNode::next
+static inline bool isMarked(uintptr_t link) {
+    return (link & 1) != 0;
+}
+
+static inline LockFreeSkipNode* getNode(uintptr_t link) {
+    return reinterpret_cast<LockFreeSkipNode*>(link & ~static_cast<uintptr_t>(1));
+}
+
+static inline uintptr_t toLink(LockFreeSkipNode* node) {
+    return reinterpret_cast<uintptr_t>(node);
+}
+
+// Deleter handed to the epoch reclaimer
+static void deleteSkipNode(void* node) {
+    delete static_cast<LockFreeSkipNode*>(node);
+}
+
+// Constructor: allocates 'height' null links. Two owners: the inserter and a future remover.
+LockFreeSkipNode::LockFreeSkipNode(int key, int height)
+    : key(key), height(height), owners(2), next(new std::atomic<uintptr_t>[height]) {
+    for (int i = 0; i < height; i++) {
+        this->next[i].store(0, std::memory_order_relaxed);
+    }
+};
+
+// Destructor: releases the links array
+LockFreeSkipNode::~LockFreeSkipNode() {
+    delete[] this->next;
+};
+
+// Constructor: Initializes an empty skip list with a full-height sentinel head
+LockFreeSkipList::LockFreeSkipList() : head(new LockFreeSkipNode(0, MAX_HEIGHT)), size(0) { };
+
+// Destructor: Releases all nodes still linked
+LockFreeSkipList::~LockFreeSkipList() {
+    this->clear();
+    delete this->head;
+};
+
+// Draws a random height: each extra level is kept with probability 1/2
+int LockFreeSkipList::randomHeight() {
+    // xorshift64 per thread, seeded from the thread id so threads do not share a sequence
+    static thread_local uint64_t state =
+        (std::hash<std::thread::id>()(std::this_thread::get_id()) | 1) * 0x9E3779B97F4A7C15ULL;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+
+    uint64_t bits = state;
+    int newHeight = 1;
+    while ((bits & 1) && newHeight < MAX_HEIGHT) {
+        newHeight++;
+        bits >>= 1;
+    }
+    return newHeight;
+};
+
+// Fills preds/succs around 'key' on every level, snipping out marked nodes on the way
+bool LockFreeSkipList::find(int key, LockFreeSkipNode** preds, LockFreeSkipNode** succs) {
+    bool retry = true;
+    while (retry) {
+        retry = false;
+        LockFreeSkipNode* pred = this->head;
+
+        for (int level = MAX_HEIGHT - 1; level >= 0 && !retry; level--) {
+            LockFreeSkipNode* current = getNode(pred->next[level].load(std::memory_order_acquire));
+
+            while (current != nullptr) {
+                uintptr_t successor = current->next[level].load(std::memory_order_acquire);
+
+                // 'current' is logically removed on this level: unlink it
+                while (isMarked(successor)) {
+                    uintptr_t expected = toLink(current);
+                    if (!pred->next[level].compare_exchange_strong(expected, successor & ~static_cast<uintptr_t>(1),
+                                                                   std::memory_order_acq_rel)) {
+                        retry = true;  // 'pred' changed or got marked itself: start over
+                        break;
+                    }
+                    current = getNode(successor);
+                    if (current == nullptr) {
+                        break;
+                    }
+                    successor = current->next[level].load(std::memory_order_acquire);
+                }
+                if (retry || current == nullptr) {
+                    break;
+                }
+
+                if (current->key < key) {
+                    pred = current;
+                    current = getNode(successor);
+                } else {
+                    break;
+                }
+            }
+
+            preds[level] = pred;
+            succs[level] = current;
+        }
+    }
+    return succs[0] != nullptr && succs[0]->key == key;
+};
+
+// Drops one owner of 'node'. Once both the inserter and the remover are done, the node
+// is marked on every level it was linked on, and it has to be unlinked from all of them
+// before it is retired. find() alone is not enough: it stops at the first node whose key
+// is >= the key, and a concurrent insert of the same key may have linked its new node
+// in front of this one (from a stale successor), hiding it from find(). So each level is
+// walked from the last node below the key across every node with an equal key, and the
+// marked ones, 'node' among them, are snipped out by identity.
+void LockFreeSkipList::release(LockFreeSkipNode* node) {
+    if (node->owners.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+
+    LockFreeSkipNode* preds[MAX_HEIGHT];
+    LockFreeSkipNode* succs[MAX_HEIGHT];
+    this->find(node->key, preds, succs);
+
+    for (int level = node->height - 1; level >= 0; level--) {
+        LockFreeSkipNode* pred = preds[level];
+        LockFreeSkipNode* current = getNode(pred->next[level].load(std::memory_order_acquire));
+        while (current != nullptr && current->key <= node->key) {
+            uintptr_t successor = current->next[level].load(std::memory_order_acquire);
+            if (!isMarked(successor)) {
+                pred = current;
+                current = getNode(successor);
+                continue;
+            }
+
+            uintptr_t expected = toLink(current);
+            if (pred->next[level].compare_exchange_strong(expected, successor & ~static_cast<uintptr_t>(1),
+                                                          std::memory_order_acq_rel)) {
+                current = getNode(successor);
+            } else {
+                // 'pred' changed or got marked itself: search again and redo this level
+                this->find(node->key, preds, succs);
+                pred = preds[level];
+                current = getNode(pred->next[level].load(std::memory_order_acquire));
+            }
+        }
+    }
+    EpochReclaimer::instance().retire(node, deleteSkipNode);
+};
+
+// insert: Links the node on level 0 (the linearization point), then on the upper levels
+bool LockFreeSkipList::insert(int key) {
+    EpochGuard guard;
+    LockFreeSkipNode* preds[MAX_HEIGHT];
+    LockFreeSkipNode* succs[MAX_HEIGHT];
+    LockFreeSkipNode* node = nullptr;
+
+    while (true) {
+        if (this->find(key, preds, succs)) {
+            delete node;  // Never published, so it can be freed directly
+            return false;
+        }
+
+        if (node == nullptr) {
+            node = new LockFreeSkipNode(key, randomHeight());
+        }
+        for (int level = 0; level < node->height; level++) {
+            node->next[level].store(toLink(succs[level]), std::memory_order_relaxed);
+        }
+
+        uintptr_t expected = toLink(succs[0]);
+        if (preds[0]->next[0].compare_exchange_strong(expected, toLink(node), std::memory_order_acq_rel)) {
+            break;
+        }
+    }
+    this->size.fetch_add(1, std::memory_order_relaxed);
+
+    // Build the upper levels; stop as soon as a remover has marked the node
+    bool removed = false;
+    for (int level = 1; level < node->height && !removed; level++) {
+        while (true) {
+            uintptr_t link = node->next[level].load(std::memory_order_acquire);
+            if (isMarked(link)) {
+                removed = true;
+                break;
+            }
+            if (getNode(link) != succs[level] &&
+                !node->next[level].compare_exchange_strong(link, toLink(succs[level]), std::memory_order_acq_rel)) {
+                continue;  // Marked in the meantime: re-check
+            }
+
+            uintptr_t expected = toLink(succs[level]);
+            if (preds[level]->next[level].compare_exchange_strong(expected, toLink(node), std::memory_order_acq_rel)) {
+                break;
+            }
+
+            // The neighbourhood changed: search again, unless the node is already gone
+            this->find(key, preds, succs);
+            if (succs[0] != node) {
+                removed = true;
+                break;
+            }
+        }
+    }
+
+    this->release(node);
+    return true;
+};
+
+// remove: Marks the upper levels, then level 0 (the linearization point)
+bool LockFreeSkipList::remove(int key) {
+    EpochGuard guard;
+    LockFreeSkipNode* preds[MAX_HEIGHT];
+    LockFreeSkipNode* succs[MAX_HEIGHT];
+
+    if (!this->find(key, preds, succs)) {
+        return false;
+    }
+    LockFreeSkipNode* victim = succs[0];
+
+    for (int level = victim->height - 1; level >= 1; level--) {
+        uintptr_t link = victim->next[level].load(std::memory_order_acquire);
+        while (!isMarked(link)) {
+            victim->next[level].compare_exchange_weak(link, link | 1, std::memory_order_acq_rel);
+        }
+    }
+
+    uintptr_t link = victim->next[0].load(std::memory_order_acquire);
+    while (true) {
+        if (isMarked(link)) {
+            return false;  // Another thread removed it first
+        }
+        if (victim->next[0].compare_exchange_strong(link, link | 1, std::memory_order_acq_rel)) {
+            break;
+        }
+    }
+    this->size.fetch_sub(1, std::memory_order_relaxed);
+
+    this->find(key, preds, succs);  // Physically unlink it now rather than on a later traversal
+    this->release(victim);
+    return true;
+};
+
+// contains: Searches without helping, skipping over marked nodes
+bool LockFreeSkipList::contains(int key) const {
+    EpochGuard guard;
+    LockFreeSkipNode* pred = this->head;
+    LockFreeSkipNode* current = nullptr;
+
+    for (int level = MAX_HEIGHT - 1; level >= 0; level--) {
+        current = getNode(pred->next[level].load(std::memory_order_acquire));
+        while (current != nullptr) {
+            uintptr_t successor = current->next[level].load(std::memory_order_acquire);
+            while (isMarked(successor)) {
+                current = getNode(successor);
+                if (current == nullptr) {
+                    break;
+                }
+                successor = current->next[level].load(std::memory_order_acquire);
+            }
+            if (current == nullptr) {
+                break;
+            }
+
+            if (current->key < key) {
+                pred = current;
+                current = getNode(successor);
+            } else {
+                break;
+            }
+        }
+    }
+    return current != nullptr && current->key == key;
+};
+
+// rangeScan: Descends to the first key >= low, then walks level 0 up to high
+std::vector<int> LockFreeSkipList::rangeScan(int low, int high) const {
+    EpochGuard guard;
+    std::vector<int> keys;
+    if (low > high) {
+        return keys;
+    }
+
+    LockFreeSkipNode* pred = this->head;
+    for (int level = MAX_HEIGHT - 1; level >= 0; level--) {
+        LockFreeSkipNode* current = getNode(pred->next[level].load(std::memory_order_acquire));
+        while (current != nullptr && current->key < low) {
+            pred = current;
+            current = getNode(current->next[level].load(std::memory_order_acquire));
+        }
+    }
+
+    LockFreeSkipNode* current = getNode(pred->next[0].load(std::memory_order_acquire));
+    while (current != nullptr && current->key <= high) {
+        uintptr_t successor = current->next[0].load(std::memory_order_acquire);
+        if (!isMarked(successor) && current->key >= low) {
+            keys.push_back(current->key);
+        }
+        current = getNode(successor);
+    }
+    return keys;
+};
+
+// getSize: Returns the current number of elements
+size_t LockFreeSkipList::getSize() const {
+    return this->size.load(std::memory_order_relaxed);
+};
+
+// isEmpty: Checks if the list is empty
+bool LockFreeSkipList::isEmpty() const {
+    return !this->getSize();
+};
+
+// clear: Removes all elements (not thread-safe)
+void LockFreeSkipList::clear() {
+    LockFreeSkipNode* current = getNode(this->head->next[0].load());
+    while (current != nullptr) {
+        LockFreeSkipNode* nextNode = getNode(current->next[0].load());
+        delete current;
+        current = nextNode;
+    }
+
+    for (int level = 0; level < MAX_HEIGHT; level++) {
+        this->head->next[level].store(0);
+    }
+    this->size.store(0);
+};
+
+// print: Traverses the bottom level and prints each element (not thread-safe)
+void LockFreeSkipList::print() const {
+    LockFreeSkipNode* current = getNode(this->head->next[0].load());
+    if (current == nullptr) {
+        std::cout << "List is empty" << std::endl;
+        return;
+    }
+
+    while (current != nullptr) {
+        std::cout << current->key;
+        current = getNode(current->next[0].load());
+        if (current != nullptr)
+            std::cout << " -> ";
+    }
+    std::cout << "\n";
+};
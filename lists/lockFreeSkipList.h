@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>    // For size_t
+#include <cstdint>    // For uintptr_t
+#include <atomic>
+#include <vector>
+
+// Node structure for the lock-free skip list.
+// The lowest bit of every 'next' word is the Harris deletion mark: once set on
+// a level, the node is logically removed from that level and the link is frozen.
+struct LockFreeSkipNode {
+    int key;                          // Key stored in the node
+    int height;                       // Number of levels this node participates in
+    std::atomic<int> owners;          // Inserter + remover; the last one to let go retires the node
+    std::atomic<uintptr_t>* next;     // Array of 'height' marked forward pointers
+
+    // Constructor: allocates 'height' null links
+    LockFreeSkipNode(int key, int height);
+
+    // Destructor: releases the links array
+    ~LockFreeSkipNode();
+};
+
+// Concurrent ordered set of ints (Herlihy-Shavit lock-free skip list).
+//
+// insert/remove/contains/rangeScan may be called from any number of threads.
+// Removed nodes are freed through EpochReclaimer once no reader can see them.
+// The constructor, destructor, clear() and print() must not run concurrently
+// with other operations.
+class LockFreeSkipList {
+private:
+    static const int MAX_HEIGHT = 24;   // Enough for ~16M elements with p = 1/2
+
+    LockFreeSkipNode* head;             // Sentinel node with MAX_HEIGHT levels (holds no key)
+    std::atomic<size_t> size;           // Number of elements (exact when quiescent)
+
+    // Draws a random height from a per-thread generator
+    static int randomHeight();
+
+    // Fills preds/succs with the nodes around 'key' on every level, unlinking marked
+    // nodes on the way. Returns true if an unmarked node with 'key' is present.
+    bool find(int key, LockFreeSkipNode** preds, LockFreeSkipNode** succs);
+
+    // Drops one owner of 'node'; the last owner unlinks it from every level (by identity,
+    // not by key, since other nodes with the same key may sit in front of it) and retires it
+    void release(LockFreeSkipNode* node);
+
+public:
+    // Constructor: Initializes an empty skip list
+    LockFreeSkipList();
+
+    // Destructor: Releases all nodes still linked
+    ~LockFreeSkipList();
+
+    LockFreeSkipList(const LockFreeSkipList&) = delete;
+    LockFreeSkipList& operator=(const LockFreeSkipList&) = delete;
+
+    // insert: Adds the key, returns false if it was already present
+    bool insert(int key);
+
+    // remove: Removes the key, returns false if it was not present
+    bool remove(int key);
+
+    // contains: Returns true if the key is present (wait-free, never writes)
+    bool contains(int key) const;
+
+    // rangeScan: Returns the keys in [low, high] in ascending order.
+    // Keys inserted or removed during the scan may or may not be reported.
+    std::vector<int> rangeScan(int low, int high) const;
+
+    // getSize: Returns the current number of elements
+    size_t getSize() const;
+
+    // isEmpty: Checks if the list is empty
+    bool isEmpty() const;
+
+    // clear: Removes all elements (not thread-safe)
+    void clear();
+
+    // print: Traverses the bottom level and prints each element (not thread-safe)
+    void print() const;
+};
@@ -1,6 +1,15 @@
 #include <iostream>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <vector>
 #include "circularDoublyLinkedList.h"
 #include "singlyLinkedList.h"
+#include "skipList.h"
+#include "xorLinkedList.h"
+#include "indexLinkedList.h"
+#include "intrusiveList.h"
+#include "lockFreeSkipList.h"
 
 void testCircularDoublyLinkedList() {
     CircularDoublyLinkedList cdll;
@@ -143,11 +152,315 @@ void testSinglyLinkedList() {
     list.print();  // Expected: (empty output)
 }
 
+void testSpliceMergeSort() {
+    // Singly linked list
+    SinglyLinkedList first;
+    SinglyLinkedList second;
+    int firstValues[] = {40, 10, 30};
+    int secondValues[] = {25, 5, 35, 15};
+    for (int value : firstValues) first.push_back(value);
+    for (int value : secondValues) second.push_back(value);
+
+    std::cout << "Testing SinglyLinkedList sort:" << std::endl;
+    first.sort();
+    second.sort();
+    first.print();   // Expected: 10 -> 30 -> 40
+    second.print();  // Expected: 5 -> 15 -> 25 -> 35
+
+    std::cout << "\nTesting SinglyLinkedList merge:" << std::endl;
+    first.merge(second);
+    first.print();   // Expected: 5 -> 10 -> 15 -> 25 -> 30 -> 35 -> 40
+    std::cout << "Second list size after merge: " << second.getSize() << std::endl;  // Expected: 0
+
+    std::cout << "\nTesting SinglyLinkedList splice of range [1, 3) to the back of another list:" << std::endl;
+    second.push_back(1);
+    second.splice(second.getSize(), first, 1, 3);
+    first.print();   // Expected: 5 -> 25 -> 30 -> 35 -> 40
+    second.print();  // Expected: 1 -> 10 -> 15
+
+    std::cout << "\nTesting SinglyLinkedList splice of a whole list at index 1:" << std::endl;
+    first.splice(1, second);
+    first.print();   // Expected: 5 -> 1 -> 10 -> 15 -> 25 -> 30 -> 35 -> 40
+
+    // Circular doubly linked list
+    CircularDoublyLinkedList ring;
+    CircularDoublyLinkedList other;
+    int ringValues[] = {9, 3, 7, 1};
+    int otherValues[] = {8, 2, 6};
+    for (int value : ringValues) ring.push_back(value);
+    for (int value : otherValues) other.push_back(value);
+
+    std::cout << "\nTesting CircularDoublyLinkedList sort and merge:" << std::endl;
+    ring.sort();
+    other.sort();
+    ring.merge(other);
+    ring.print();    // Expected: 1 -> 2 -> 3 -> 6 -> 7 -> 8 -> 9
+    std::cout << "Front: " << ring.front() << ", Back: " << ring.back() << std::endl;  // Expected: 1, 9
+
+    std::cout << "\nTesting CircularDoublyLinkedList splice of range [2, 5) to the front of another list:" << std::endl;
+    other.push_back(100);
+    other.splice(0, ring, 2, 5);
+    ring.print();    // Expected: 1 -> 2 -> 8 -> 9
+    other.print();   // Expected: 3 -> 6 -> 7 -> 100
+}
+
+// Runs the same sequence of operations on any list exposing the CircularDoublyLinkedList API
+template<typename List>
+void exerciseCompactList(List& list) {
+    list.push_back(20);
+    list.push_back(30);
+    list.push_front(10);    // List: 10 -> 20 -> 30
+    list.insert(3, 40);     // List: 10 -> 20 -> 30 -> 40
+    list.insert(1, 15);     // List: 10 -> 15 -> 20 -> 30 -> 40
+    list.print();
+    list.remove(3);         // List: 10 -> 15 -> 20 -> 40
+    list.pop_front();       // List: 15 -> 20 -> 40
+    list.pop_back();        // List: 15 -> 20
+    list.print();
+    std::cout << "Front: " << list.front() << ", Back: " << list.back() << ", Size: " << list.getSize() << std::endl;
+
+    // splice, merge and sort, as in CircularDoublyLinkedList
+    List other;
+    other.push_back(50);
+    other.push_back(5);
+    other.push_back(25);
+    list.splice(1, other, 0, 2);    // List: 15 -> 50 -> 5 -> 20, other: 25
+    list.print();
+    list.sort();                    // List: 5 -> 15 -> 20 -> 50
+    other.push_back(30);            // Other: 25 -> 30
+    list.merge(other);              // List: 5 -> 15 -> 20 -> 25 -> 30 -> 50
+    list.print();
+
+    // Memory per element for a large sequence
+    list.clear();
+    const int count = 1000000;
+    for (int i = 0; i < count; i++) {
+        list.push_back(i);
+    }
+    std::cout << "Bytes per element for " << count << " ints: "
+              << static_cast<double>(list.memoryUsage()) / count << std::endl;
+    list.clear();
+}
+
+void testCompactLists() {
+    std::cout << "Testing XorLinkedList:" << std::endl;
+    XorLinkedList xorList;
+    exerciseCompactList(xorList);
+
+    std::cout << "\nTesting IndexLinkedList:" << std::endl;
+    IndexLinkedList indexList;
+    exerciseCompactList(indexList);
+
+    std::cout << "\nFor comparison, sizeof(DNode) is " << sizeof(DNode)
+              << " bytes before allocator overhead (typically 32 bytes per heap allocation)" << std::endl;
+}
+
+// Cache entry that carries its own list hook, so LRU bookkeeping never allocates
+struct CacheEntry : ListHook {
+    int key;
+    std::string value;
+
+    CacheEntry(int key, const std::string& value) : key(key), value(value) { }
+};
+
+void printLru(IntrusiveList& lru) {
+    if (lru.isEmpty()) {
+        std::cout << "List is empty" << std::endl;
+        return;
+    }
+    ListHook* hook = &lru.front();
+    for (size_t i = 0; i < lru.getSize(); i++) {
+        std::cout << static_cast<CacheEntry*>(hook)->key;
+        hook = hook->next;
+        if (i + 1 < lru.getSize()) {
+            std::cout << " -> ";
+        }
+    }
+    std::cout << "\n";
+}
+
+void testIntrusiveList() {
+    std::vector<CacheEntry> entries;
+    for (int key = 1; key <= 4; key++) {
+        entries.emplace_back(key, "value " + std::to_string(key));
+    }
+    IntrusiveList lru;  // Front = most recently used, back = eviction candidate
+
+    std::cout << "Testing push_front (most recent first):" << std::endl;
+    for (int i = 0; i < 3; i++) {
+        lru.push_front(entries[i]);
+    }
+    printLru(lru);  // Expected: 3 -> 2 -> 1
+
+    std::cout << "\nTesting moveToFront (access key 1, then key 2):" << std::endl;
+    lru.moveToFront(entries[0]);
+    printLru(lru);  // Expected: 1 -> 3 -> 2
+    lru.moveToFront(entries[1]);
+    printLru(lru);  // Expected: 2 -> 1 -> 3
+
+    std::cout << "\nTesting eviction with pop_back before adding key 4:" << std::endl;
+    CacheEntry& evicted = static_cast<CacheEntry&>(lru.pop_back());
+    std::cout << "Evicted key " << evicted.key << " (" << evicted.value << ")" << std::endl;  // Expected: 3
+    lru.push_front(entries[3]);
+    printLru(lru);  // Expected: 4 -> 2 -> 1
+
+    std::cout << "\nTesting unlink and moveToBack:" << std::endl;
+    lru.unlink(entries[1]);
+    std::cout << "Key 2 linked? " << (entries[1].isLinked() ? "Yes" : "No") << std::endl;  // Expected: No
+    lru.moveToBack(entries[3]);
+    printLru(lru);  // Expected: 1 -> 4
+
+    std::cout << "\nTesting clear:" << std::endl;
+    lru.clear();
+    printLru(lru);  // Expected: List is empty
+}
+
+void testSkipList() {
+    SkipList skipList;
+
+    std::cout << "Initial list (should be empty):" << std::endl;
+    skipList.print();
+
+    // Test insert: values are kept in order, insert returns the index they landed on
+    std::cout << "\nTesting insert:" << std::endl;
+    int values[] = {30, 10, 50, 20, 40, 20};
+    for (int value : values) {
+        size_t index = skipList.insert(value);
+        std::cout << "Inserted " << value << " at index " << index << ": ";
+        skipList.print();
+    }
+    std::cout << "Size after insert: " << skipList.getSize() << std::endl;  // Expected: 6
+
+    // Test keyed lookup
+    std::cout << "\nTesting contains and indexOf:" << std::endl;
+    std::cout << "Contains 40? " << (skipList.contains(40) ? "Yes" : "No") << std::endl;  // Expected: Yes
+    std::cout << "Contains 35? " << (skipList.contains(35) ? "Yes" : "No") << std::endl;  // Expected: No
+    std::cout << "Index of 40: " << skipList.indexOf(40) << std::endl;                     // Expected: 4
+
+    // Test indexed access
+    std::cout << "\nTesting at:" << std::endl;
+    for (size_t i = 0; i < skipList.getSize(); i++) {
+        std::cout << "at(" << i << ") = " << skipList.at(i) << std::endl;
+    }
+    std::cout << "Front: " << skipList.front() << ", Back: " << skipList.back() << std::endl;  // Expected: 10, 50
+
+    // Test removal by value and by index
+    std::cout << "\nTesting remove (value 20) and removeAt (index 0):" << std::endl;
+    skipList.remove(20);
+    skipList.print();  // Expected: 10 -> 20 -> 30 -> 40 -> 50
+    skipList.removeAt(0);
+    skipList.print();  // Expected: 20 -> 30 -> 40 -> 50
+
+    // Test clear
+    std::cout << "\nTesting clear:" << std::endl;
+    skipList.clear();
+    skipList.print();  // Expected: List is empty
+}
+
+void testLockFreeSkipList() {
+    LockFreeSkipList skipList;
+
+    // Test insert from several threads: each thread inserts its own residue class
+    std::cout << "Testing concurrent insert (4 threads, keys 0..39):" << std::endl;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; t++) {
+        workers.emplace_back([&skipList, t]() {
+            for (int key = t; key < 40; key += 4) {
+                skipList.insert(key);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    skipList.print();  // Expected: 0 -> 1 -> ... -> 39
+    std::cout << "Size: " << skipList.getSize() << std::endl;  // Expected: 40
+
+    // Test duplicate insert and remove
+    std::cout << "\nInserting duplicate 10: " << (skipList.insert(10) ? "inserted" : "rejected") << std::endl;  // Expected: rejected
+    std::cout << "Removing 10: " << (skipList.remove(10) ? "removed" : "not found") << std::endl;              // Expected: removed
+    std::cout << "Removing 10 again: " << (skipList.remove(10) ? "removed" : "not found") << std::endl;        // Expected: not found
+    std::cout << "Contains 10? " << (skipList.contains(10) ? "Yes" : "No") << std::endl;                      // Expected: No
+
+    // Test concurrent remove of the odd keys
+    std::cout << "\nTesting concurrent remove of odd keys:" << std::endl;
+    workers.clear();
+    for (int t = 0; t < 2; t++) {
+        workers.emplace_back([&skipList, t]() {
+            for (int key = 1 + 2 * t; key < 40; key += 4) {
+                skipList.remove(key);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    skipList.print();  // Expected: even keys except 10
+
+    // Test rangeScan
+    std::cout << "\nTesting rangeScan(5, 20): ";
+    for (int key : skipList.rangeScan(5, 20)) {
+        std::cout << key << " ";  // Expected: 6 8 12 14 16 18 20
+    }
+    std::cout << std::endl;
+
+    // Test concurrent insert and remove of one key: a node removed while another thread
+    // inserts the same key must still be unlinked from every level before it is freed
+    std::cout << "\nTesting concurrent insert/remove of key 25 (4 threads) with a reader:" << std::endl;
+    std::atomic<bool> churning(true);
+    std::thread reader([&skipList, &churning]() {
+        while (churning.load()) {
+            skipList.contains(25);
+            skipList.rangeScan(20, 30);
+        }
+    });
+    workers.clear();
+    for (int t = 0; t < 4; t++) {
+        workers.emplace_back([&skipList, t]() {
+            for (int i = 0; i < 20000; i++) {
+                if (t % 2 == 0) {
+                    skipList.insert(25);
+                } else {
+                    skipList.remove(25);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    churning.store(false);
+    reader.join();
+    skipList.remove(25);
+    skipList.print();  // Expected: even keys except 10, as before
+    std::cout << "Size: " << skipList.getSize() << std::endl;  // Expected: 19
+
+    // Test clear
+    std::cout << "\nTesting clear:" << std::endl;
+    skipList.clear();
+    skipList.print();  // Expected: List is empty
+}
+
 int main() {
     std::cout << "----------Testing Singly Linked List--------------\n" << std::endl;
     testSinglyLinkedList();
     std::cout << "\n++++++++++++++++++++++++++++++++++\n" << std::endl;
     std::cout << "----------Testing Circular Doubly Linked List--------------\n" << std::endl;
     testCircularDoublyLinkedList();
+    std::cout << "\n++++++++++++++++++++++++++++++++++\n" << std::endl;
+    std::cout << "----------Testing Splice, Merge and Sort--------------\n" << std::endl;
+    testSpliceMergeSort();
+    std::cout << "\n++++++++++++++++++++++++++++++++++\n" << std::endl;
+    std::cout << "----------Testing Compact Lists--------------\n" << std::endl;
+    testCompactLists();
+    std::cout << "\n++++++++++++++++++++++++++++++++++\n" << std::endl;
+    std::cout << "----------Testing Intrusive List--------------\n" << std::endl;
+    testIntrusiveList();
+    std::cout << "\n++++++++++++++++++++++++++++++++++\n" << std::endl;
+    std::cout << "----------Testing Skip List--------------\n" << std::endl;
+    testSkipList();
+    std::cout << "\n++++++++++++++++++++++++++++++++++\n" << std::endl;
+    std::cout << "----------Testing Lock-Free Skip List--------------\n" << std::endl;
+    testLockFreeSkipList();
     return 0;
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <cstddef>    // For size_t
 #include <stdexcept>  // For exceptions
 #include "singlyLinkedList.h"
+#include "listMerge.h"
 
 
 // Constructor for Node: initializes the node's data with the given value and next pointer to nullptr
@@ -221,3 +222,113 @@ void SinglyLinkedList::print() const {
     }
     std::cout << "\n";
 };
+
+// nodeAt: Returns the node at the specified index (index must be valid)
+Node* SinglyLinkedList::nodeAt(size_t index) const {
+    if (index == this->size - 1) {     // The tail is reachable directly
+        return this->tail;
+    }
+
+    Node* current = this->head;
+    for (size_t i = 0; i < index; i++) {
+        current = current->next;
+    }
+    return current;
+};
+
+// linkChain: Links the chain first..last of 'count' nodes so that 'first' ends up at 'index'
+void SinglyLinkedList::linkChain(size_t index, Node* first, Node* last, size_t count) {
+    if (index == 0) {                           // Chain becomes the new beginning
+        last->next = this->head;
+        this->head = first;
+        if (this->size == 0) {
+            this->tail = last;
+        }
+    } else {
+        Node* previousNode = this->nodeAt(index - 1);
+        last->next = previousNode->next;
+        previousNode->next = first;
+        if (previousNode == this->tail) {       // Chain was appended at the end
+            this->tail = last;
+        }
+    }
+    this->size += count;
+};
+
+// splice: Moves every node of 'other' into this list so that they start at 'index'
+void SinglyLinkedList::splice(size_t index, SinglyLinkedList& other) {
+    if (&other == this) {
+        throw std::invalid_argument("Cannot splice a list into itself");
+    }
+    if (index > this->size) {
+        throw std::out_of_range("Index is out of bounds");
+    }
+    if (other.isEmpty()) {
+        return;
+    }
+
+    this->linkChain(index, other.head, other.tail, other.size);
+
+    other.head = other.tail = nullptr;          // 'other' no longer owns the nodes
+    other.size = 0;
+};
+
+// splice: Moves the nodes [first, last) of 'other' into this list so that they start at 'index'
+void SinglyLinkedList::splice(size_t index, SinglyLinkedList& other, size_t first, size_t last) {
+    if (&other == this) {
+        throw std::invalid_argument("Cannot splice a list into itself");
+    }
+    if (index > this->size || first > last || last > other.size) {
+        throw std::out_of_range("Index is out of bounds");
+    }
+    if (first == last) {
+        return;
+    }
+
+    // Locate the range and the node right before it in 'other'
+    Node* beforeFirst = (first == 0) ? nullptr : other.nodeAt(first - 1);
+    Node* firstNode = (beforeFirst != nullptr) ? beforeFirst->next : other.head;
+    Node* lastNode = firstNode;
+    for (size_t i = first + 1; i < last; i++) {
+        lastNode = lastNode->next;
+    }
+
+    // Detach the range from 'other'
+    if (beforeFirst != nullptr) {
+        beforeFirst->next = lastNode->next;
+    } else {
+        other.head = lastNode->next;
+    }
+    if (lastNode == other.tail) {
+        other.tail = beforeFirst;
+    }
+    other.size -= last - first;
+
+    this->linkChain(index, firstNode, lastNode, last - first);
+};
+
+// merge: Merges the sorted list 'other' into this sorted list, leaving 'other' empty
+void SinglyLinkedList::merge(SinglyLinkedList& other) {
+    if (&other == this || other.isEmpty()) {
+        return;
+    }
+
+    Node* newTail = nullptr;
+    this->head = mergeChains(this->head, other.head, newTail);
+    this->tail = newTail;
+    this->size += other.size;
+
+    other.head = other.tail = nullptr;
+    other.size = 0;
+};
+
+// sort: Sorts the list in ascending order by relinking nodes
+void SinglyLinkedList::sort() {
+    if (this->size < 2) {
+        return;
+    }
+
+    Node* newTail = nullptr;
+    this->head = sortChain(this->head, this->size, newTail);
+    this->tail = newTail;
+};
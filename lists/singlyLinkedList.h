@@ -18,6 +18,12 @@ private:
     Node* tail;   // (Optional) Pointer to the last node for efficient push_back
     size_t size;  // Current number of elements in the list
 
+    // nodeAt: Returns the node at the specified index (index must be valid)
+    Node* nodeAt(size_t index) const;
+
+    // linkChain: Links the chain first..last of 'count' nodes so that 'first' ends up at 'index'
+    void linkChain(size_t index, Node* first, Node* last, size_t count);
+
 public:
     // Constructor: Initializes an empty list
     SinglyLinkedList();
@@ -64,6 +70,23 @@ public:
     // clear: Removes all elements from the list and frees memory
     void clear();
 
+    // splice: Moves every node of 'other' into this list so that they start at 'index'.
+    // Only pointers are relinked: O(1) at the front or back, otherwise O(index) to reach the position.
+    // Throws an exception if the index is out of bounds or 'other' is this list.
+    void splice(size_t index, SinglyLinkedList& other);
+
+    // splice: Moves the nodes [first, last) of 'other' into this list so that they start at 'index'.
+    // Throws an exception if either range is invalid or 'other' is this list.
+    void splice(size_t index, SinglyLinkedList& other, size_t first, size_t last);
+
+    // merge: Merges the sorted list 'other' into this sorted list, leaving 'other' empty.
+    // Nodes are relinked, not copied; equal elements of this list stay first.
+    void merge(SinglyLinkedList& other);
+
+    // sort: Sorts the list in ascending order with a bottom-up merge sort that relinks nodes
+    // (stable, O(n log n), no allocation).
+    void sort();
+
     // print: Traverses the list and prints each element
     void print() const;
 };
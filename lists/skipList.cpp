@@ -0,0 +1,274 @@
+#include <cstddef>    // For size_t
+#include <cstdint>    // For uint64_t
+#include <stdexcept>
+#include <iostream>
+#include "skipList.h"
+
+// Constructor: allocates 'height' empty levels
+SkipNode::SkipNode(int value, int height) : data(value), height(height), levels(new SkipLevel[height]) {
+    for (int i = 0; i < height; i++) {
+        this->levels[i].next = nullptr;
+        this->levels[i].span = 0;
+    }
+};
+
+// Destructor: releases the levels array
+SkipNode::~SkipNode() {
+    delete[] this->levels;
+};
+
+// Constructor: Initializes an empty skip list with a full-height sentinel head
+SkipList::SkipList(uint64_t seed) : head(new SkipNode(0, MAX_HEIGHT)), height(1), size(0), rngState(seed ? seed : 1) { };
+
+// Destructor: Releases all allocated nodes, including the sentinel
+SkipList::~SkipList() {
+    this->clear();
+    delete this->head;
+};
+
+// Draws a random height: each extra level is kept with probability 1/2
+int SkipList::randomHeight() {
+    // xorshift64: cheap and good enough for choosing node heights
+    this->rngState ^= this->rngState << 13;
+    this->rngState ^= this->rngState >> 7;
+    this->rngState ^= this->rngState << 17;
+
+    uint64_t bits = this->rngState;
+    int newHeight = 1;
+    while ((bits & 1) && newHeight < MAX_HEIGHT) {  // Count the trailing ones of the random word
+        newHeight++;
+        bits >>= 1;
+    }
+    return newHeight;
+};
+
+// Returns the node at the specified index by accumulating spans from the top level down
+SkipNode* SkipList::nodeAt(size_t index) const {
+    size_t targetRank = index + 1;     // Ranks are 1-based, the head has rank 0
+    size_t traversed = 0;
+    SkipNode* current = this->head;
+
+    for (int i = this->height - 1; i >= 0; i--) {
+        while (current->levels[i].next != nullptr && traversed + current->levels[i].span <= targetRank) {
+            traversed += current->levels[i].span;
+            current = current->levels[i].next;
+        }
+        if (traversed == targetRank) {
+            return current;
+        }
+    }
+    return current;
+};
+
+// Unlinks 'node' on every level, fixing the spans of the predecessors, and deletes it
+void SkipList::unlinkNode(SkipNode* node, SkipNode** update) {
+    for (int i = 0; i < this->height; i++) {
+        if (update[i]->levels[i].next == node) {
+            // The predecessor now jumps over the removed node's span, minus the node itself
+            update[i]->levels[i].span += node->levels[i].span - 1;
+            update[i]->levels[i].next = node->levels[i].next;
+        } else {
+            // The link passes over the removed node without stopping on it
+            update[i]->levels[i].span--;
+        }
+    }
+
+    // Drop empty top levels
+    while (this->height > 1 && this->head->levels[this->height - 1].next == nullptr) {
+        this->height--;
+    }
+
+    this->size--;
+    delete node;
+};
+
+// insert: Inserts a value keeping the list sorted and returns its index
+size_t SkipList::insert(int value) {
+    SkipNode* update[MAX_HEIGHT];  // Last node before the insertion point on each level
+    size_t rank[MAX_HEIGHT];       // Rank of update[i]
+
+    SkipNode* current = this->head;
+    for (int i = this->height - 1; i >= 0; i--) {
+        rank[i] = (i == this->height - 1) ? 0 : rank[i + 1];
+        while (current->levels[i].next != nullptr && current->levels[i].next->data <= value) {
+            rank[i] += current->levels[i].span;
+            current = current->levels[i].next;
+        }
+        update[i] = current;
+    }
+
+    int newHeight = this->randomHeight();
+    if (newHeight > this->height) {
+        // New levels start at the head and span the whole list
+        for (int i = this->height; i < newHeight; i++) {
+            rank[i] = 0;
+            update[i] = this->head;
+            update[i]->levels[i].span = this->size;
+        }
+        this->height = newHeight;
+    }
+
+    SkipNode* node = new SkipNode(value, newHeight);
+    for (int i = 0; i < newHeight; i++) {
+        node->levels[i].next = update[i]->levels[i].next;
+        update[i]->levels[i].next = node;
+
+        // Split the predecessor's span around the new node
+        node->levels[i].span = update[i]->levels[i].span - (rank[0] - rank[i]);
+        update[i]->levels[i].span = (rank[0] - rank[i]) + 1;
+    }
+
+    // Levels above the new node now pass over one more element
+    for (int i = newHeight; i < this->height; i++) {
+        update[i]->levels[i].span++;
+    }
+
+    this->size++;
+    return rank[0];  // The new node has 1-based rank rank[0] + 1
+};
+
+// remove: Removes the first occurrence of the value, returns false if it is not present
+bool SkipList::remove(int value) {
+    SkipNode* update[MAX_HEIGHT];
+
+    SkipNode* current = this->head;
+    for (int i = this->height - 1; i >= 0; i--) {
+        while (current->levels[i].next != nullptr && current->levels[i].next->data < value) {
+            current = current->levels[i].next;
+        }
+        update[i] = current;
+    }
+
+    SkipNode* target = current->levels[0].next;
+    if (target == nullptr || target->data != value) {
+        return false;
+    }
+
+    this->unlinkNode(target, update);
+    return true;
+};
+
+// removeAt: Removes the element at the specified index (0-indexed)
+// Throws an exception if the index is invalid.
+void SkipList::removeAt(size_t index) {
+    if (index >= this->size) {
+        throw std::out_of_range("Index is out of bounds");
+    }
+
+    SkipNode* update[MAX_HEIGHT];
+    size_t traversed = 0;
+
+    SkipNode* current = this->head;
+    for (int i = this->height - 1; i >= 0; i--) {
+        // Stop right before the target, whose 1-based rank is index + 1
+        while (current->levels[i].next != nullptr && traversed + current->levels[i].span <= index) {
+            traversed += current->levels[i].span;
+            current = current->levels[i].next;
+        }
+        update[i] = current;
+    }
+
+    this->unlinkNode(current->levels[0].next, update);
+};
+
+// contains: Returns true if the value exists in the list
+bool SkipList::contains(int value) const {
+    SkipNode* current = this->head;
+    for (int i = this->height - 1; i >= 0; i--) {
+        while (current->levels[i].next != nullptr && current->levels[i].next->data < value) {
+            current = current->levels[i].next;
+        }
+    }
+    current = current->levels[0].next;
+    return current != nullptr && current->data == value;
+};
+
+// indexOf: Returns the index of the first occurrence of the value
+// Throws an exception if the value is not present.
+size_t SkipList::indexOf(int value) const {
+    size_t traversed = 0;
+    SkipNode* current = this->head;
+    for (int i = this->height - 1; i >= 0; i--) {
+        while (current->levels[i].next != nullptr && current->levels[i].next->data < value) {
+            traversed += current->levels[i].span;
+            current = current->levels[i].next;
+        }
+    }
+
+    current = current->levels[0].next;
+    if (current == nullptr || current->data != value) {
+        throw std::out_of_range("Value not found");
+    }
+    return traversed;  // 'traversed' is the 1-based rank of the predecessor, i.e. the 0-based index of the value
+};
+
+// at: Returns the element at the specified index (0-indexed)
+// Throws an exception if the index is invalid.
+int SkipList::at(size_t index) const {
+    if (index >= this->size) {
+        throw std::out_of_range("Index is out of bounds");
+    }
+    return this->nodeAt(index)->data;
+};
+
+// front: Returns the smallest element
+// Throws an exception if the list is empty.
+int SkipList::front() const {
+    if (this->isEmpty()) {
+        throw std::out_of_range("List is empty");
+    }
+    return this->head->levels[0].next->data;
+};
+
+// back: Returns the largest element
+// Throws an exception if the list is empty.
+int SkipList::back() const {
+    if (this->isEmpty()) {
+        throw std::out_of_range("List is empty");
+    }
+    return this->nodeAt(this->size - 1)->data;
+};
+
+// getSize: Returns the current number of elements in the list
+size_t SkipList::getSize() const {
+    return this->size;
+};
+
+// isEmpty: Checks if the list is empty
+bool SkipList::isEmpty() const {
+    return !this->size;
+};
+
+// clear: Removes all elements from the list and frees memory (the sentinel is kept)
+void SkipList::clear() {
+    SkipNode* current = this->head->levels[0].next;
+    while (current != nullptr) {
+        SkipNode* nextNode = current->levels[0].next;
+        delete current;
+        current = nextNode;
+    }
+
+    for (int i = 0; i < MAX_HEIGHT; i++) {
+        this->head->levels[i].next = nullptr;
+        this->head->levels[i].span = 0;
+    }
+    this->height = 1;
+    this->size = 0;
+};
+
+// print: Traverses the bottom level and prints each element
+void SkipList::print() const {
+    SkipNode* current = this->head->levels[0].next;
+    if (current == nullptr) {
+        std::cout << "List is empty" << std::endl;
+        return;
+    }
+
+    while (current != nullptr) {
+        std::cout << current->data;
+        if (current->levels[0].next != nullptr)
+            std::cout << " -> ";
+        current = current->levels[0].next;
+    }
+    std::cout << "\n";
+};
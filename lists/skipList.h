@@ -0,0 +1,98 @@
+#pragma once
+#include <cstddef>    // For size_t
+#include <cstdint>    // For uint64_t
+#include <stdexcept>
+#include <iostream>
+
+// One forward link of a skip list node. 'span' counts how many level-0 nodes
+// the link jumps over, which is what makes rank (index) queries O(log n).
+struct SkipLevel {
+    struct SkipNode* next;  // Next node on this level (nullptr at the end)
+    size_t span;            // Number of positions advanced by following 'next'
+};
+
+// Node structure for the skip list
+struct SkipNode {
+    int data;            // Data stored in the node
+    int height;          // Number of levels this node participates in
+    SkipLevel* levels;   // Array of 'height' forward links
+
+    // Constructor: allocates 'height' empty levels
+    SkipNode(int value, int height);
+
+    // Destructor: releases the levels array
+    ~SkipNode();
+};
+
+// Ordered skip list with span counts: keyed and indexed access in expected O(log n)
+class SkipList {
+private:
+    static const int MAX_HEIGHT = 32;  // Enough for 2^32 elements with p = 1/2
+
+    SkipNode* head;      // Sentinel node with MAX_HEIGHT levels (holds no data)
+    int height;          // Number of levels currently in use
+    size_t size;         // Current number of elements in the list
+    uint64_t rngState;   // State of the xorshift generator used for node heights
+
+    // Draws a random height with P(height >= k) = 2^-(k-1)
+    int randomHeight();
+
+    // Returns the node at the specified index (0-indexed), index must be valid
+    SkipNode* nodeAt(size_t index) const;
+
+    // Unlinks and deletes 'node', given its predecessor on every level in 'update'
+    void unlinkNode(SkipNode* node, SkipNode** update);
+
+public:
+    // Constructor: Initializes an empty skip list (the seed makes heights reproducible)
+    explicit SkipList(uint64_t seed = 0x9E3779B97F4A7C15ULL);
+
+    // Destructor: Releases all allocated nodes
+    ~SkipList();
+
+    // Copying would share nodes between lists
+    SkipList(const SkipList&) = delete;
+    SkipList& operator=(const SkipList&) = delete;
+
+    // insert: Inserts a value keeping the list sorted (duplicates are kept, after equal values)
+    // Returns the index where the value was placed.
+    size_t insert(int value);
+
+    // remove: Removes the first occurrence of the value, returns false if it is not present
+    bool remove(int value);
+
+    // removeAt: Removes the element at the specified index (0-indexed)
+    // Throws an exception if the index is invalid.
+    void removeAt(size_t index);
+
+    // contains: Returns true if the value exists in the list
+    bool contains(int value) const;
+
+    // indexOf: Returns the index of the first occurrence of the value
+    // Throws an exception if the value is not present.
+    size_t indexOf(int value) const;
+
+    // at: Returns the element at the specified index (0-indexed)
+    // Throws an exception if the index is invalid.
+    int at(size_t index) const;
+
+    // front: Returns the smallest element
+    // Throws an exception if the list is empty.
+    int front() const;
+
+    // back: Returns the largest element
+    // Throws an exception if the list is empty.
+    int back() const;
+
+    // getSize: Returns the current number of elements in the list
+    size_t getSize() const;
+
+    // isEmpty: Checks if the list is empty
+    bool isEmpty() const;
+
+    // clear: Removes all elements from the list and frees memory
+    void clear();
+
+    // print: Traverses the bottom level and prints each element
+    void print() const;
+};
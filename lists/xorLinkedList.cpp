@@ -0,0 +1,390 @@
+#include <cstddef>    // For size_t
+#include <cstdint>    // For uint32_t, UINT32_MAX
+#include <stdexcept>
+#include <iostream>
+#include <vector>
+#include "xorLinkedList.h"
+#include "listMerge.h"
+
+// Constructor: Initializes an empty list (the pool is created on the first insertion)
+XorLinkedList::XorLinkedList() : head(0), tail(0), freeList(0), size(0) { };
+
+// allocateNode: Takes a free slot (or grows the pool) and stores the value in it
+uint32_t XorLinkedList::allocateNode(int value) {
+    uint32_t index;
+    if (this->freeList != 0) {                           // Reuse a released slot
+        index = this->freeList;
+        this->freeList = this->nodes[index].link;
+    } else {
+        if (this->nodes.empty()) {
+            this->nodes.push_back(XorNode{0, 0});        // Reserved slot 0, never holds data
+        }
+        if (this->nodes.size() == UINT32_MAX) {
+            throw std::length_error("List is full");
+        }
+        index = static_cast<uint32_t>(this->nodes.size());
+        this->nodes.push_back(XorNode{0, 0});
+    }
+
+    this->nodes[index].data = value;
+    this->nodes[index].link = 0;
+    return index;
+};
+
+// releaseNode: Returns a slot to the free list
+void XorLinkedList::releaseNode(uint32_t index) {
+    this->nodes[index].link = this->freeList;
+    this->freeList = index;
+};
+
+// locate: Finds the node at 'index' and its predecessor, walking from the closer end
+void XorLinkedList::locate(size_t index, uint32_t& previous, uint32_t& current) const {
+    if (index < this->size / 2) {
+        previous = 0;
+        current = this->head;
+        for (size_t i = 0; i < index; i++) {
+            uint32_t nextNode = this->nodes[current].link ^ previous;  // Undo the XOR with where we came from
+            previous = current;
+            current = nextNode;
+        }
+    } else {
+        // Walk backwards from the tail; 'after' trails behind on the right
+        uint32_t after = 0;
+        current = this->tail;
+        for (size_t i = this->size - 1; i > index; i--) {
+            uint32_t previousNode = this->nodes[current].link ^ after;
+            after = current;
+            current = previousNode;
+        }
+        previous = this->nodes[current].link ^ after;
+    }
+};
+
+// copyChain: Copies 'count' elements of 'source' into new slots of this pool, chained in order
+uint32_t XorLinkedList::copyChain(const XorLinkedList& source, uint32_t previous, uint32_t from, size_t count,
+                                  uint32_t& last) {
+    uint32_t first = 0;
+    last = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t copy = this->allocateNode(source.nodes[from].data);
+        if (last != 0) {
+            this->nodes[last].link = copy;
+        } else {
+            first = copy;
+        }
+        last = copy;
+        uint32_t nextNode = source.nodes[from].link ^ previous;
+        previous = from;
+        from = nextNode;
+    }
+    return first;
+};
+
+// linkChain: Links a plain chain first..last of 'count' nodes so that 'first' ends up at 'index'
+void XorLinkedList::linkChain(size_t index, uint32_t first, uint32_t last, size_t count) {
+    uint32_t previousNode = this->tail;         // Appending: between the tail and "no node"
+    uint32_t currentNode = 0;
+    if (index < this->size) {
+        this->locate(index, previousNode, currentNode);
+    }
+
+    // Rewrite the chain's links as prev ^ next, with the neighbours at both ends
+    uint32_t before = previousNode;
+    uint32_t node = first;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t after = (node == last) ? currentNode : this->nodes[node].link;
+        this->nodes[node].link = before ^ after;
+        before = node;
+        node = after;
+    }
+
+    if (previousNode != 0) {
+        this->nodes[previousNode].link ^= currentNode ^ first;   // previous: next becomes first
+    } else {
+        this->head = first;
+    }
+    if (currentNode != 0) {
+        this->nodes[currentNode].link ^= previousNode ^ last;    // current: prev becomes last
+    } else {
+        this->tail = last;
+    }
+    this->size += count;
+};
+
+// openChain: Turns every XOR link into the plain index of the next node
+void XorLinkedList::openChain() {
+    uint32_t previousNode = 0;
+    uint32_t current = this->head;
+    while (current != 0) {
+        uint32_t nextNode = this->nodes[current].link ^ previousNode;
+        this->nodes[current].link = nextNode;
+        previousNode = current;
+        current = nextNode;
+    }
+};
+
+// closeChain: Makes the plain chain starting at 'first' the list again
+void XorLinkedList::closeChain(uint32_t first) {
+    uint32_t previousNode = 0;
+    uint32_t current = first;
+    while (current != 0) {
+        uint32_t nextNode = this->nodes[current].link;
+        this->nodes[current].link = previousNode ^ nextNode;
+        previousNode = current;
+        current = nextNode;
+    }
+    this->head = first;
+    this->tail = previousNode;
+};
+
+// push_front: Inserts an element at the beginning of the list
+void XorLinkedList::push_front(int value) {
+    uint32_t newNode = this->allocateNode(value);
+    this->nodes[newNode].link = this->head;              // prev = 0, next = head
+
+    if (this->size > 0) {
+        this->nodes[this->head].link ^= newNode;         // The old head's prev changes from 0 to newNode
+    } else {
+        this->tail = newNode;
+    }
+    this->head = newNode;
+    this->size++;
+};
+
+// push_back: Inserts an element at the end of the list
+void XorLinkedList::push_back(int value) {
+    uint32_t newNode = this->allocateNode(value);
+    this->nodes[newNode].link = this->tail;              // prev = tail, next = 0
+
+    if (this->size > 0) {
+        this->nodes[this->tail].link ^= newNode;         // The old tail's next changes from 0 to newNode
+    } else {
+        this->head = newNode;
+    }
+    this->tail = newNode;
+    this->size++;
+};
+
+// insert: Inserts an element at the specified index (0-indexed)
+// Throws an exception if the index is out of bounds.
+void XorLinkedList::insert(size_t index, int value) {
+    if (index > this->size) {
+        throw std::out_of_range("Index is out of bounds");
+    }
+    if (index == 0) {
+        this->push_front(value);
+        return;
+    }
+    if (index == this->size) {
+        this->push_back(value);
+        return;
+    }
+
+    uint32_t previousNode, currentNode;
+    this->locate(index, previousNode, currentNode);
+
+    uint32_t newNode = this->allocateNode(value);
+    this->nodes[newNode].link = previousNode ^ currentNode;
+    this->nodes[previousNode].link ^= currentNode ^ newNode;   // previous: next becomes newNode
+    this->nodes[currentNode].link ^= previousNode ^ newNode;   // current: prev becomes newNode
+    this->size++;
+};
+
+// pop_front: Removes the element at the beginning of the list
+// Throws an exception if the list is empty.
+void XorLinkedList::pop_front() {
+    if (this->isEmpty()) {
+        throw std::out_of_range("List is empty");
+    }
+    this->remove(0);
+};
+
+// pop_back: Removes the element at the end of the list
+// Throws an exception if the list is empty.
+void XorLinkedList::pop_back() {
+    if (this->isEmpty()) {
+        throw std::out_of_range("List is empty");
+    }
+    this->remove(this->size - 1);
+};
+
+// remove: Removes the element at the specified index (0-indexed)
+// Throws an exception if the index is invalid.
+void XorLinkedList::remove(size_t index) {
+    if (index >= this->size) {
+        throw std::out_of_range("Index is out of bounds");
+    }
+
+    uint32_t previousNode, currentNode;
+    this->locate(index, previousNode, currentNode);
+    uint32_t nextNode = this->nodes[currentNode].link ^ previousNode;
+
+    if (previousNode != 0) {
+        this->nodes[previousNode].link ^= currentNode ^ nextNode;
+    } else {
+        this->head = nextNode;
+    }
+    if (nextNode != 0) {
+        this->nodes[nextNode].link ^= currentNode ^ previousNode;
+    } else {
+        this->tail = previousNode;
+    }
+
+    this->releaseNode(currentNode);
+    this->size--;
+};
+
+// front: Returns a reference to the first element
+// Throws an exception if the list is empty.
+int& XorLinkedList::front() {
+    if (this->isEmpty()) {
+        throw std::out_of_range("List is empty");
+    }
+    return this->nodes[this->head].data;
+};
+
+// back: Returns a reference to the last element
+// Throws an exception if the list is empty.
+int& XorLinkedList::back() {
+    if (this->isEmpty()) {
+        throw std::out_of_range("List is empty");
+    }
+    return this->nodes[this->tail].data;
+};
+
+// getSize: Returns the current number of elements in the list
+size_t XorLinkedList::getSize() const {
+    return this->size;
+};
+
+// isEmpty: Checks if the list is empty
+bool XorLinkedList::isEmpty() const {
+    return !this->size;
+};
+
+// clear: Removes all elements from the list and frees the pool
+void XorLinkedList::clear() {
+    std::vector<XorNode>().swap(this->nodes);
+    this->head = this->tail = this->freeList = 0;
+    this->size = 0;
+};
+
+// splice: Moves every element of 'other' into this list so that they start at 'index'
+void XorLinkedList::splice(size_t index, XorLinkedList& other) {
+    if (&other == this) {
+        throw std::invalid_argument("Cannot splice a list into itself");
+    }
+    if (index > this->size) {
+        throw std::out_of_range("Index is out of bounds");
+    }
+    if (other.isEmpty()) {
+        return;
+    }
+
+    uint32_t last;
+    uint32_t first = this->copyChain(other, 0, other.head, other.size, last);
+    this->linkChain(index, first, last, other.size);
+    other.clear();
+};
+
+// splice: Moves the elements [first, last) of 'other' into this list so that they start at 'index'
+void XorLinkedList::splice(size_t index, XorLinkedList& other, size_t first, size_t last) {
+    if (&other == this) {
+        throw std::invalid_argument("Cannot splice a list into itself");
+    }
+    if (index > this->size || first > last || last > other.size) {
+        throw std::out_of_range("Index is out of bounds");
+    }
+    if (first == last) {
+        return;
+    }
+
+    size_t count = last - first;
+    uint32_t previousNode, firstNode;
+    other.locate(first, previousNode, firstNode);
+    uint32_t chainLast;
+    uint32_t chainFirst = this->copyChain(other, previousNode, firstNode, count, chainLast);
+
+    // Release the range in 'other', then join its neighbours
+    uint32_t before = previousNode;
+    uint32_t current = firstNode;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t nextNode = other.nodes[current].link ^ before;
+        before = current;
+        other.releaseNode(current);
+        current = nextNode;
+    }
+    uint32_t lastNode = before;
+    if (previousNode != 0) {
+        other.nodes[previousNode].link ^= firstNode ^ current;
+    } else {
+        other.head = current;
+    }
+    if (current != 0) {
+        other.nodes[current].link ^= lastNode ^ previousNode;
+    } else {
+        other.tail = previousNode;
+    }
+    other.size -= count;
+
+    this->linkChain(index, chainFirst, chainLast, count);
+};
+
+// merge: Merges the sorted list 'other' into this sorted list, leaving 'other' empty
+void XorLinkedList::merge(XorLinkedList& other) {
+    if (&other == this || other.isEmpty()) {
+        return;
+    }
+    if (this->isEmpty()) {
+        this->splice(0, other);
+        return;
+    }
+
+    uint32_t otherLast;
+    uint32_t otherFirst = this->copyChain(other, 0, other.head, other.size, otherLast);
+
+    this->openChain();
+    uint32_t newTail = 0;
+    uint32_t newHead = mergeIndexChains(this->nodes, &XorNode::link, this->head, otherFirst, newTail);
+    this->closeChain(newHead);
+    this->size += other.size;
+    other.clear();
+};
+
+// sort: Sorts the list in ascending order by relinking indices
+void XorLinkedList::sort() {
+    if (this->size < 2) {
+        return;
+    }
+
+    this->openChain();
+    uint32_t newTail = 0;
+    uint32_t newHead = sortIndexChain(this->nodes, &XorNode::link, this->head, this->size, newTail);
+    this->closeChain(newHead);
+};
+
+// memoryUsage: Returns the bytes reserved by the node pool
+size_t XorLinkedList::memoryUsage() const {
+    return this->nodes.capacity() * sizeof(XorNode);
+};
+
+// print: Traverses the list and prints its elements (for debugging/testing)
+void XorLinkedList::print() const {
+    if (this->isEmpty()) {
+        std::cout << "List is empty" << std::endl;
+        return;
+    }
+
+    uint32_t previousNode = 0;
+    uint32_t current = this->head;
+    while (current != 0) {
+        std::cout << this->nodes[current].data;
+        uint32_t nextNode = this->nodes[current].link ^ previousNode;
+        previousNode = current;
+        current = nextNode;
+        if (current != 0) {
+            std::cout << " -> ";
+        }
+    }
+    std::cout << "\n";
+};
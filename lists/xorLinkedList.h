@@ -0,0 +1,123 @@
+#pragma once
+#include <cstddef>    // For size_t
+#include <cstdint>    // For uint32_t
+#include <stdexcept>
+#include <vector>
+
+// Node structure for the XOR-linked list: 8 bytes instead of the 24 of a DNode.
+// 'link' holds (index of previous node) XOR (index of next node), so a node can be
+// crossed in either direction as long as the neighbour we came from is known.
+struct XorNode {
+    int data;        // Data stored in the node
+    uint32_t link;   // prev ^ next, as indices into the node pool (0 means "no node")
+};
+
+// Doubly linked list whose nodes live in one pooled array and store a single XOR link.
+// Exposes the same operations as CircularDoublyLinkedList.
+class XorLinkedList {
+private:
+    std::vector<XorNode> nodes;  // Node pool; slot 0 is reserved so that index 0 can mean "no node"
+    uint32_t head;               // Index of the first node (0 if empty)
+    uint32_t tail;               // Index of the last node (0 if empty)
+    uint32_t freeList;           // First free slot, free slots are chained through 'link'
+    size_t size;                 // Current number of elements in the list
+
+    // allocateNode: Takes a free slot (or grows the pool) and stores the value in it
+    uint32_t allocateNode(int value);
+
+    // releaseNode: Returns a slot to the free list
+    void releaseNode(uint32_t index);
+
+    // locate: Finds the node at 'index' and its predecessor, walking from the closer end
+    void locate(size_t index, uint32_t& previous, uint32_t& current) const;
+
+    // copyChain: Copies 'count' elements of 'source', starting at its node 'from' (reached
+    // from 'previous'), into new slots of this pool. Returns the first new slot and stores
+    // the last in 'last'; the copies are chained through 'link' as plain next indices.
+    uint32_t copyChain(const XorLinkedList& source, uint32_t previous, uint32_t from, size_t count, uint32_t& last);
+
+    // linkChain: Links a plain chain first..last of 'count' nodes so that 'first' ends up
+    // at 'index', turning its links into XOR links on the way
+    void linkChain(size_t index, uint32_t first, uint32_t last, size_t count);
+
+    // openChain: Turns every XOR link into the plain index of the next node (0 at the end),
+    // so the list can be relinked through 'link' like a singly linked chain
+    void openChain();
+
+    // closeChain: Makes the plain chain starting at 'first' the list again, rebuilding
+    // the XOR links and the tail
+    void closeChain(uint32_t first);
+
+public:
+    // Constructor: Initializes an empty list
+    XorLinkedList();
+
+    // Destructor: The pool is released with the vector
+    ~XorLinkedList() = default;
+
+    // push_front: Inserts an element at the beginning of the list
+    void push_front(int value);
+
+    // push_back: Inserts an element at the end of the list
+    void push_back(int value);
+
+    // insert: Inserts an element at the specified index (0-indexed)
+    // Throws an exception if the index is out of bounds.
+    void insert(size_t index, int value);
+
+    // pop_front: Removes the element at the beginning of the list
+    // Throws an exception if the list is empty.
+    void pop_front();
+
+    // pop_back: Removes the element at the end of the list
+    // Throws an exception if the list is empty.
+    void pop_back();
+
+    // remove: Removes the element at the specified index (0-indexed)
+    // Throws an exception if the index is invalid.
+    void remove(size_t index);
+
+    // front: Returns a reference to the first element
+    // Throws an exception if the list is empty.
+    int& front();
+
+    // back: Returns a reference to the last element
+    // Throws an exception if the list is empty.
+    int& back();
+
+    // getSize: Returns the current number of elements in the list
+    size_t getSize() const;
+
+    // isEmpty: Checks if the list is empty
+    bool isEmpty() const;
+
+    // clear: Removes all elements from the list and frees the pool
+    void clear();
+
+    // splice: Moves every element of 'other' into this list so that they start at 'index'.
+    // Each list has its own pool, so the elements are copied into free slots of this one
+    // and 'other' is cleared: O(size of other), plus O(min(index, size - index)) to find
+    // the position. Throws an exception if the index is out of bounds or 'other' is this list.
+    void splice(size_t index, XorLinkedList& other);
+
+    // splice: Moves the elements [first, last) of 'other' into this list so that they start
+    // at 'index' (copied, as above; their slots in 'other' are released).
+    // Throws an exception if either range is invalid or 'other' is this list.
+    void splice(size_t index, XorLinkedList& other, size_t first, size_t last);
+
+    // merge: Merges the sorted list 'other' into this sorted list, leaving 'other' empty.
+    // The elements of 'other' are copied into this pool, then the nodes are merged by
+    // relinking indices; equal elements of this list stay first.
+    void merge(XorLinkedList& other);
+
+    // sort: Sorts the list in ascending order with a bottom-up merge sort that relinks
+    // indices within the pool (stable, O(n log n), no allocation). The links are plain
+    // next indices while it runs and XOR links again afterwards.
+    void sort();
+
+    // memoryUsage: Returns the bytes reserved by the node pool
+    size_t memoryUsage() const;
+
+    // print: Traverses the list and prints its elements (for debugging/testing)
+    void print() const;
+};
@@ -1,3 +1,4 @@
+#include <algorithm>   // For std::max
 #include <iostream>
 #include "AVLTree.h"
 
@@ -160,6 +161,42 @@ typename AVLTree<T>::Node* AVLTree<T>::minValueNode(Node* node) const {
     return current;
 }
 
+// Heights are recomputed from the bottom of the path up. An insert needs at most one
+// (single or double) rotation: it restores the height the subtree had before the insert,
+// so the loop ends there. A remove may rotate at several levels, and ends at the first
+// node whose subtree height is unchanged.
+template<typename T>
+void AVLTree<T>::rebalancePath(Node** path[], int depth) {
+    while (depth > 0) {
+        Node** link = path[--depth];
+        Node* node = *link;
+        int oldHeight = node->height;
+        node->height = 1 + std::max(
+            this->height(node->left),
+            this->height(node->right)
+        );
+
+        int balance = this->getBalance(node);
+        if (balance > 1) {
+            // Left Right Case first becomes a Left Left Case
+            if (this->getBalance(node->left) < 0) {
+                node->left = this->leftRotate(node->left);
+            }
+            node = *link = this->rightRotate(node);
+        } else if (balance < -1) {
+            // Right Left Case first becomes a Right Right Case
+            if (this->getBalance(node->right) > 0) {
+                node->right = this->rightRotate(node->right);
+            }
+            node = *link = this->leftRotate(node);
+        }
+
+        if (node->height == oldHeight) {
+            return;
+        }
+    }
+}
+
 // Constructor: Initializes an empty AVL tree
 template<typename T>
 AVLTree<T>::AVLTree() : root(nullptr) { }
@@ -184,32 +221,96 @@ int AVLTree<T>::getBalance(Node* node) const {
     return this->height(node->left) - this->height(node->right);
 }
 
-// Inserts a value into the AVL tree
+// Inserts a value into the AVL tree: walks down to the empty link where the value
+// belongs, remembering every link on the way, then rebalances back up
 template<typename T>
 void AVLTree<T>::insert(const T& value) {
-    this->root = this->recInsert(this->root, value);
-    return;
+    Node** path[MAX_HEIGHT];
+    int depth = 0;
+    Node** link = &this->root;
+    while (*link) {
+        path[depth++] = link;
+        if (value > (*link)->data) {
+            link = &(*link)->right;
+        } else if (value < (*link)->data) {
+            link = &(*link)->left;
+        } else {
+            return;  // Duplicates not allowed
+        }
+    }
+    *link = new Node(value);
+    this->rebalancePath(path, depth);
 }
 
-// Removes a value from the AVL tree
+// Removes a value from the AVL tree. A node with two children takes the value of its
+// inorder successor, and the successor (which has no left child) is unlinked instead;
+// the path then runs down to the successor's parent.
 template<typename T>
 void AVLTree<T>::remove(const T& value) {
-    this->root = this->recRemove(this->root, value);
-    return;
+    Node** path[MAX_HEIGHT];
+    int depth = 0;
+    Node** link = &this->root;
+    while (*link && !(value == (*link)->data)) {
+        path[depth++] = link;
+        link = value > (*link)->data ? &(*link)->right : &(*link)->left;
+    }
+    Node* node = *link;
+    if (!node) return;  // Value not found
+
+    if (node->left && node->right) {
+        path[depth++] = link;
+        link = &node->right;
+        while ((*link)->left) {
+            path[depth++] = link;
+            link = &(*link)->left;
+        }
+        Node* successor = *link;
+        node->data = successor->data;
+        node = successor;
+    }
+    *link = node->left ? node->left : node->right;
+    delete node;
+    this->rebalancePath(path, depth);
 }
 
-// Clears the subtree rooted at 'node'
+// Recursive insert, as insert was before the iterative version
 template<typename T>
-void AVLTree<T>::clear(Node* node) {
-    if (node == nullptr) return; // Base case: If node is null, return
+void AVLTree<T>::insertRecursive(const T& value) {
+    this->root = this->recInsert(this->root, value);
+}
 
-    this->clear(node->left);   // Recursively delete the left subtree
-    this->clear(node->right);  // Recursively delete the right subtree
+// Recursive remove, as remove was before the iterative version
+template<typename T>
+void AVLTree<T>::removeRecursive(const T& value) {
+    this->root = this->recRemove(this->root, value);
+}
 
-    delete node; // Free the current node
+// Clears the subtree rooted at 'node'. A right rotation at a node with a left child
+// moves that child up; once the node has no left child it can be deleted, and its
+// right subtree is cleared the same way. Every node is rotated up at most once.
+template<typename T>
+void AVLTree<T>::clear(Node* node) {
+    while (node) {
+        if (node->left) {
+            Node* left = node->left;
+            node->left = left->right;
+            left->right = node;
+            node = left;
+        } else {
+            Node* right = node->right;
+            delete node;
+            node = right;
+        }
+    }
     this->root = nullptr;
 }
 
+// Clears the whole tree
+template<typename T>
+void AVLTree<T>::clear() {
+    this->clear(this->root);
+}
+
 // Prints the values of the subtree in order (left-root-right)
 template<typename T>
 void AVLTree<T>::printInOrder(Node* node) const {
@@ -231,3 +332,85 @@ template<typename T>
 bool AVLTree<T>::isBalanced(Node* node) {
     return (this->getBalance(node) <= 1 && this->getBalance(node) >= -1) ? true : false;
 }
+
+// Iterator to the smallest value: the left spine of the whole tree
+template<typename T>
+typename AVLTree<T>::const_iterator AVLTree<T>::begin() const {
+    const_iterator it;
+    it.path.reserve(this->height(this->root));
+    it.pushLeftSpine(this->root);
+    return it;
+}
+
+template<typename T>
+typename AVLTree<T>::const_iterator AVLTree<T>::end() const {
+    return const_iterator();
+}
+
+// Returns true if the value is in the tree
+template<typename T>
+bool AVLTree<T>::contains(const T& value) const {
+    const Node* node = this->root;
+    while (node) {
+        if (value > node->data) {
+            node = node->right;
+        } else if (value < node->data) {
+            node = node->left;
+        } else {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Returns an iterator to the value, or end() if it is not in the tree
+template<typename T>
+typename AVLTree<T>::const_iterator AVLTree<T>::find(const T& value) const {
+    const_iterator it = this->lowerBound(value);
+    if (it != this->end() && value < *it) {
+        return this->end();
+    }
+    return it;
+}
+
+// One walk down from the root: every node where the search turns left is a candidate
+// and stays on the iterator's path (the later candidates are smaller), every node where
+// it turns right is too small and is left out. The last candidate is the answer.
+template<typename T>
+typename AVLTree<T>::const_iterator AVLTree<T>::lowerBound(const T& value) const {
+    const_iterator it;
+    it.path.reserve(this->height(this->root));   // The path is never longer than the tree is tall
+    for (const Node* node = this->root; node;) {
+        if (node->data < value) {
+            node = node->right;
+        } else {
+            it.path.push_back(node);
+            node = node->left;
+        }
+    }
+    return it;
+}
+
+// As lowerBound, with nodes equal to 'value' counted as too small
+template<typename T>
+typename AVLTree<T>::const_iterator AVLTree<T>::upperBound(const T& value) const {
+    const_iterator it;
+    it.path.reserve(this->height(this->root));   // The path is never longer than the tree is tall
+    for (const Node* node = this->root; node;) {
+        if (value < node->data) {
+            it.path.push_back(node);
+            node = node->left;
+        } else {
+            node = node->right;
+        }
+    }
+    return it;
+}
+
+// Calls visit(value) in ascending order for every value in [lo, hi]
+template<typename T>
+void AVLTree<T>::forEachInRange(const T& lo, const T& hi, const std::function<void(const T&)>& visit) const {
+    for (const_iterator it = this->lowerBound(lo); it != this->end() && !(hi < *it); ++it) {
+        visit(*it);
+    }
+}
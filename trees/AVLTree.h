@@ -1,5 +1,9 @@
 #pragma once
+#include <cstddef>      // For std::ptrdiff_t
+#include <functional>
 #include <iostream>
+#include <iterator>     // For std::forward_iterator_tag
+#include <vector>
 
 template<typename T>
 class AVLTree {
@@ -32,6 +36,16 @@ private:
     // Finds the node with the minimum value in the subtree rooted at 'node'
     Node* minValueNode(Node* node) const;
 
+    // Upper bound on the height of any AVL tree that fits in memory: a tree of height h
+    // holds at least F(h + 2) - 1 nodes (F: Fibonacci numbers), over 2^64 for h = 93
+    static const int MAX_HEIGHT = 96;
+
+    // Retraces the search path of an insert or remove bottom-up: path[0..depth - 1] are
+    // the links (root or child pointers) leading to each node on it. Updates heights,
+    // rotates where a node is out of balance, and stops as soon as a subtree keeps
+    // its height, since nothing above it can change then.
+    void rebalancePath(Node** path[], int depth);
+
 public:
     // Constructor: Initializes an empty AVL tree
     AVLTree();
@@ -45,15 +59,26 @@ public:
     // Computes the balance factor of a node (height of the left subtree - height of the right subtree)
     int getBalance(Node* node) const;
 
-    // Inserts a value into the AVL tree
+    // Inserts a value into the AVL tree. Iterative: the search path is kept on a fixed
+    // array instead of the call stack, and rebalancing stops early (see rebalancePath).
     void insert(const T& value);
 
-    // Removes a value from the AVL tree
+    // Removes a value from the AVL tree (iterative, like insert)
     void remove(const T& value);
 
-    // Clears the subtree rooted at 'node' (used by the destructor)
+    // Recursive insert and remove (recInsert/recRemove), kept for comparison in benchmark.cpp
+    void insertRecursive(const T& value);
+
+    void removeRecursive(const T& value);
+
+    // Clears the subtree rooted at 'node' (used by the destructor). Iterative, with no
+    // stack at all: left children are rotated up until the node has none, then the node
+    // is deleted and its right child is next.
     void clear(Node* node);
 
+    // Clears the whole tree
+    void clear();
+
     // Prints the values of the subtree in order (used for debugging)
     void printInOrder(Node* node) const;
 
@@ -62,4 +87,86 @@ public:
 
     // Return 0 if the tree is not balanced, return 1 if it is
     bool isBalanced(Node* node);
+
+    // In-order (ascending) iterator. The nodes have no parent pointers, so the iterator
+    // keeps the path of nodes still to be visited: the current node on top, below it
+    // every ancestor whose left subtree the walk is in. A step pops the current node
+    // and pushes the left spine of its right subtree, O(1) amortized. Values cannot be
+    // changed through it (that could break the ordering), and any insert, remove or
+    // clear invalidates every iterator.
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() = default;
+
+        reference operator*() const {
+            return this->path.back()->data;
+        }
+
+        pointer operator->() const {
+            return &this->path.back()->data;
+        }
+
+        const_iterator& operator++() {
+            const Node* right = this->path.back()->right;
+            this->path.pop_back();
+            this->pushLeftSpine(right);
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const const_iterator& other) const {
+            if (this->path.empty() || other.path.empty()) {
+                return this->path.empty() && other.path.empty();
+            }
+            return this->path.back() == other.path.back();
+        }
+
+        bool operator!=(const const_iterator& other) const {
+            return !(*this == other);
+        }
+
+    private:
+        friend class AVLTree;
+
+        std::vector<const Node*> path;   // Empty at the end
+
+        void pushLeftSpine(const Node* node) {
+            for (; node; node = node->left) {
+                this->path.push_back(node);
+            }
+        }
+    };
+
+    using iterator = const_iterator;
+
+    const_iterator begin() const;
+
+    const_iterator end() const;
+
+    // Returns true if the value is in the tree
+    bool contains(const T& value) const;
+
+    // Returns an iterator to the value, or end() if it is not in the tree
+    const_iterator find(const T& value) const;
+
+    // lowerBound: Iterator to the smallest value not less than 'value' (end() if none)
+    const_iterator lowerBound(const T& value) const;
+
+    // upperBound: Iterator to the smallest value greater than 'value' (end() if none)
+    const_iterator upperBound(const T& value) const;
+
+    // forEachInRange: Calls visit(value) in ascending order for every value in [lo, hi].
+    // Only the O(log n) nodes on the way to 'lo' and the k values in range are visited.
+    void forEachInRange(const T& lo, const T& hi, const std::function<void(const T&)>& visit) const;
 };
\ No newline at end of file
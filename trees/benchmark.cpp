@@ -0,0 +1,139 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include "AVLTree.h"
+
+// Distinct pseudo-random non-negative keys: i -> i * odd constant is a bijection modulo 2^31
+static std::vector<int> makeKeys(size_t count, uint32_t salt) {
+    std::vector<int> keys(count);
+    for (size_t i = 0; i < count; i++) {
+        uint32_t mixed = static_cast<uint32_t>(i) * 2654435761u + salt;
+        keys[i] = static_cast<int>(mixed & 0x7FFFFFFF);
+    }
+    return keys;
+}
+
+// Nanoseconds per call of 'operation' over every key
+template<typename Operation>
+static double nanosecondsPerKey(const std::vector<int>& keys, Operation operation) {
+    auto start = std::chrono::steady_clock::now();
+    for (int key : keys) {
+        operation(key);
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / keys.size();
+}
+
+// Builds a tree from 'keys' and empties it again, once with the recursive insert/remove
+// and once with the iterative ones. Removal goes in a different order than insertion.
+static void benchmarkOrder(const char* name, const std::vector<int>& keys, const std::vector<int>& removals) {
+    AVLTree<int> recursive;
+    double recursiveInsertNs = nanosecondsPerKey(keys, [&](int key) { recursive.insertRecursive(key); });
+    bool recursiveBalanced = recursive.isBalanced(recursive.getRoot());
+    double recursiveRemoveNs = nanosecondsPerKey(removals, [&](int key) { recursive.removeRecursive(key); });
+
+    AVLTree<int> iterative;
+    double iterativeInsertNs = nanosecondsPerKey(keys, [&](int key) { iterative.insert(key); });
+    bool iterativeBalanced = iterative.isBalanced(iterative.getRoot());
+    double iterativeRemoveNs = nanosecondsPerKey(removals, [&](int key) { iterative.remove(key); });
+
+    std::cout << std::setw(16) << name << std::setw(12) << "insert" << std::setw(14) << std::fixed << std::setprecision(1)
+              << recursiveInsertNs << std::setw(14) << iterativeInsertNs << std::endl
+              << std::setw(16) << "" << std::setw(12) << "remove" << std::setw(14) << recursiveRemoveNs
+              << std::setw(14) << iterativeRemoveNs << std::endl;
+    if (!recursiveBalanced || !iterativeBalanced || recursive.getRoot() || iterative.getRoot()) {
+        std::cout << "  (unexpected: unbalanced or non-empty tree)" << std::endl;
+    }
+}
+
+// Recursive versus iterative insert and remove on random and on sorted keys (sorted keys
+// rotate on almost every insert), then the time to clear a full tree
+static void benchmarkInsertRemove(size_t count) {
+    std::vector<int> keys = makeKeys(count, 0);
+    std::vector<int> removals = makeKeys(count, 0);
+    for (size_t i = 0; i + 1 < count; i += 2) {
+        std::swap(removals[i], removals[count - 1 - i]);
+    }
+    std::vector<int> sorted(count);
+    for (size_t i = 0; i < count; i++) {
+        sorted[i] = static_cast<int>(i);
+    }
+
+    std::cout << "--- AVLTree, " << count << " keys (ns per operation) ---" << std::endl;
+    std::cout << std::setw(16) << "keys" << std::setw(12) << "operation" << std::setw(14) << "recursive"
+              << std::setw(14) << "iterative" << std::endl;
+    benchmarkOrder("random", keys, removals);
+    benchmarkOrder("sorted", sorted, sorted);
+
+    AVLTree<int> tree;
+    for (int key : keys) {
+        tree.insert(key);
+    }
+    auto start = std::chrono::steady_clock::now();
+    tree.clear();
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << std::setw(28) << "clear (iterative)" << std::setw(28) << elapsed.count() / count << std::endl << std::endl;
+}
+
+// Lookups, then range queries of about RANGE_KEYS keys each: forEachInRange against a
+// full in-order walk that filters every value, which is what callers had to do before
+static void benchmarkQueries(size_t count) {
+    const size_t RANGE_KEYS = 100;
+    const size_t QUERIES = 20;
+    std::vector<int> keys = makeKeys(count, 0);
+    AVLTree<int> tree;
+    for (int key : keys) {
+        tree.insert(key);
+    }
+
+    std::cout << "--- AVLTree queries, " << count << " keys ---" << std::endl;
+    volatile size_t found = 0;
+    double hitNs = nanosecondsPerKey(keys, [&](int key) { found = found + tree.contains(key); });
+    double lowerBoundNs = nanosecondsPerKey(keys, [&](int key) { found = found + (tree.lowerBound(key) != tree.end()); });
+
+    // Keys are spread evenly over 0..2^31 - 1, so a span of 2^31 / count * RANGE_KEYS holds about RANGE_KEYS
+    const int MAX_KEY = 2147483647;
+    int span = static_cast<int>((static_cast<double>(MAX_KEY) / count) * RANGE_KEYS);
+    auto rangeEnd = [&](int lo) { return lo > MAX_KEY - span ? MAX_KEY : lo + span; };
+    std::vector<int> starts(keys.begin(), keys.begin() + (QUERIES < count ? QUERIES : count));
+    size_t inRange = 0;
+    double rangeNs = nanosecondsPerKey(starts, [&](int lo) {
+        tree.forEachInRange(lo, rangeEnd(lo), [&](const int&) { inRange++; });
+    });
+    size_t scanned = 0;
+    double scanNs = nanosecondsPerKey(starts, [&](int lo) {
+        for (int value : tree) {
+            if (value >= lo && value <= rangeEnd(lo)) scanned++;
+        }
+    });
+
+    std::cout << std::setw(36) << "contains, hit (ns)" << std::setw(14) << std::fixed << std::setprecision(1) << hitNs << std::endl
+              << std::setw(36) << "lowerBound, hit (ns)" << std::setw(14) << lowerBoundNs << std::endl
+              << std::setw(36) << "forEachInRange per query (us)" << std::setw(14) << rangeNs / 1000 << std::endl
+              << std::setw(36) << "full walk + filter per query (us)" << std::setw(14) << scanNs / 1000 << std::endl
+              << std::setw(36) << "values per query" << std::setw(14) << static_cast<double>(inRange) / starts.size() << std::endl;
+    if (inRange != scanned) {
+        std::cout << "  (unexpected: the two range queries disagree)" << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    // Usage: ./benchmark [keyCount ...], e.g. ./benchmark 1000000 10000000
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; i++) {
+        sizes.push_back(static_cast<size_t>(std::atoll(argv[i])));
+    }
+    if (sizes.empty()) {
+        sizes.push_back(1000000);
+    }
+
+    for (size_t count : sizes) {
+        benchmarkInsertRemove(count);
+        benchmarkQueries(count);
+    }
+    return 0;
+}
@@ -53,7 +53,32 @@ int main() {
     // Implement a function to verify the balance of the tree if not already present
     std::cout << "Tree is balanced: " << std::boolalpha << avl.isBalanced(avl.getRoot()) << std::endl;
 
-    // Test 5: Clear the Tree
+    // Test 5: Sorted insertions (a rotation on almost every insert)
+    AVLTree<int> sortedTree;
+    for (int i = 0; i < 100000; i++) {
+        sortedTree.insert(i);
+    }
+    for (int i = 0; i < 100000; i += 2) {
+        sortedTree.remove(i);
+    }
+    std::cout << "Sorted tree of 50000 odd values: height " << sortedTree.height(sortedTree.getRoot())
+              << ", balanced: " << sortedTree.isBalanced(sortedTree.getRoot()) << std::endl;
+    sortedTree.clear();
+
+    // Test 6: Search, bounds and range queries
+    std::cout << "Contains 27: " << avl.contains(27) << ", contains 30: " << avl.contains(30) << std::endl;
+    std::cout << "lowerBound(30): " << *avl.lowerBound(30) << ", upperBound(35): " << *avl.upperBound(35)
+              << ", upperBound(55) is end: " << (avl.upperBound(55) == avl.end()) << std::endl;
+    std::cout << "Values in [20, 45]: ";
+    avl.forEachInRange(20, 45, [](const int& value) { std::cout << value << " "; });
+    std::cout << std::endl;
+    std::cout << "Iterating from 40: ";
+    for (AVLTree<int>::const_iterator it = avl.find(40); it != avl.end(); ++it) {
+        std::cout << *it << " ";
+    }
+    std::cout << std::endl;
+
+    // Test 7: Clear the Tree
     std::cout << "Clearing the entire tree." << std::endl;
     avl.clear(avl.getRoot());
     std::cout << "In-order traversal after clearing: ";